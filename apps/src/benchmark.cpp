@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * Standard benchmark of the uterine simulations, runs the cases of a
+ * benchmark file and writes the cost of each phase in a JSON file.
+ *
+ * usage: benchmark [benchmark file] [--output <file>]
+ */
+
+#include <iostream>
+#include <string>
+
+#include "ExecutableSupport.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "PetscException.hpp"
+
+#include "../../include/benchmark/UterineBenchmark.hpp"
+
+int main(int argc, char *argv[]) {
+    ExecutableSupport::StandardStartup(&argc, &argv);
+
+    int exit_code = ExecutableSupport::EXIT_OK;
+
+    try {
+      // Absolute, relative to the current or to the config directory
+      std::string benchmark_file = "benchmark/standard.toml";
+      std::string output_path = "";  // Default in the benchmark test output
+
+      for (int i = 1; i < argc; ++i) {
+        const std::string option(argv[i]);
+
+        if (option == "--output" && i + 1 < argc) {
+          output_path = argv[++i];
+        } else if (option.rfind("--", 0) != 0) {
+          benchmark_file = option;
+        } else {
+          const std::string err_msg = "Invalid option " + option;
+          const std::string err_filename = "benchmark.cpp";
+          unsigned line_number = 42;
+
+          throw Exception(err_msg, err_filename, line_number);
+        }
+      }
+
+      UterineBenchmark benchmark(benchmark_file);
+      benchmark.Run(output_path);
+    }
+    catch (const Exception& e) {
+        ExecutableSupport::PrintError(e.GetMessage());
+        exit_code = ExecutableSupport::EXIT_ERROR;
+    }
+
+    ExecutableSupport::FinalizePetsc();
+    return exit_code;
+}
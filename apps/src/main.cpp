@@ -50,8 +50,25 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscException.hpp"
 
 #include "../../include/simulation.hpp"
+#include "../../include/sweep/UterineSweep.hpp"
+#include "../../include/sweep/UterineSweepScheduler.hpp"
+#include "../../include/utils/config_fcts.hpp"
 
 int main(int argc, char *argv[]) {
+    // Split the processes in groups for concurrent sweeps, this has to be
+    // done before PETSc is set up
+    unsigned group_size = 0;  // Processes per sweep point, 0 to use all
+
+    for (int i = 2; i + 1 < argc; ++i) {
+      if (std::string(argv[i]) == "--group-size") {
+        group_size = std::atoi(argv[i + 1]);
+      }
+    }
+
+    if (group_size > 0) {
+      UterineSweepScheduler::InitialiseGroups(&argc, &argv, group_size);
+    }
+
     // This sets up PETSc and prints out copyright information, etc.
     ExecutableSupport::StandardStartup(&argc, &argv);
 
@@ -60,26 +77,28 @@ int main(int argc, char *argv[]) {
     // You should put all the main code within a try-catch, to ensure that
     // you clean up PETSc before quitting.
     try {
+      int dim = 2;  // Default to 2d simulation
+      std::string resume_dir = "";  // Checkpoint to resume from
+      std::string sweep_file = "";  // Sweep specification
+      toml::value overrides = toml::table{};  // Config values of --set
+
       if (argc < 2) {
-        // Default to 2d simulation
         std::cout << "Default simulation" << std::endl;
-        run_simulation(2);
       } else {
         std::istringstream string_stream(argv[1]);
-        int dim;
 
         if (!(string_stream >> dim)) {
           // Check if input is an integer
           const std::string err_msg = "Input is not an integer";
           const std::string err_filename = "main.cpp";
-          unsigned line_number = 77;
+          unsigned line_number = 96;
 
           throw Exception(err_msg, err_filename, line_number);
         } else if (!string_stream.eof()) {
           // Check that the input is just an integer
           const std::string err_msg = "Trailing characters after input";
           const std::string err_filename = "main.cpp";
-          unsigned line_number = 84;
+          unsigned line_number = 103;
 
           throw Exception(err_msg, err_filename, line_number);
         }
@@ -87,13 +106,68 @@ int main(int argc, char *argv[]) {
         if (dim != 2 && dim != 3) {
           const std::string err_msg = "Invalid dimension";
           const std::string err_filename = "main.cpp";
-          unsigned line_number = 101;
+          unsigned line_number = 111;
 
           throw Exception(err_msg, err_filename, line_number);
+        }
+      }
+
+      // Optional arguments after the dimension
+      for (int i = 2; i < argc; ++i) {
+        const std::string option(argv[i]);
+
+        if (option == "--resume" && i + 1 < argc) {
+          // Archive directory relative to CHASTE_TEST_OUTPUT
+          resume_dir = argv[++i];
+        } else if (option == "--sweep" && i + 1 < argc) {
+          // Absolute, relative to the current or to the config directory
+          sweep_file = argv[++i];
+        } else if (option == "--config" && i + 1 < argc) {
+          // Replaces the general config file of the dimension
+          set_general_config_file(find_config_file(argv[++i]));
+        } else if (option == "--set" && i + 1 < argc) {
+          // [section.]key=value, applied on top of the config files
+          add_config_override(overrides, argv[++i]);
+        } else if (option == "--group-size" && i + 1 < argc) {
+          ++i;  // Already used to split the processes
         } else {
-          run_simulation(dim);
+          const std::string err_msg = "Invalid option " + option;
+          const std::string err_filename = "main.cpp";
+          unsigned line_number = 138;
+
+          throw Exception(err_msg, err_filename, line_number);
         }
       }
+
+      if (!sweep_file.empty() && !resume_dir.empty()) {
+        const std::string err_msg = "Cannot resume a sweep";
+        const std::string err_filename = "main.cpp";
+        unsigned line_number = 147;
+
+        throw Exception(err_msg, err_filename, line_number);
+      }
+
+      if (group_size > 0 && sweep_file.empty()) {
+        const std::string err_msg = "--group-size is only used by sweeps";
+        const std::string err_filename = "main.cpp";
+        unsigned line_number = 155;
+
+        throw Exception(err_msg, err_filename, line_number);
+      }
+
+      set_config_overrides(overrides);
+
+      if (sweep_file.empty()) {
+        run_simulation(dim, resume_dir);
+      } else if (group_size > 0) {
+        // Groups of processes take the points from a shared queue
+        UterineSweep sweep(dim, sweep_file);
+        UterineSweepScheduler scheduler;
+        scheduler.Run(sweep);
+      } else {
+        UterineSweep sweep(dim, sweep_file);
+        sweep.Run();
+      }
     }
     catch (const Exception& e) {
         ExecutableSupport::PrintError(e.GetMessage());
@@ -106,5 +180,6 @@ int main(int argc, char *argv[]) {
     // End by finalizing PETSc, and returning a suitable exit code.
     // 0 means 'no error'
     ExecutableSupport::FinalizePetsc();
+    UterineSweepScheduler::FinaliseGroups();
     return exit_code;
 }
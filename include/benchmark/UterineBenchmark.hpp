@@ -0,0 +1,49 @@
+#ifndef INCLUDE_BENCHMARK_UTERINEBENCHMARK_HPP_
+#define INCLUDE_BENCHMARK_UTERINEBENCHMARK_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <mpi.h>
+#include <sys/utsname.h>
+
+#include "../toml.hpp"
+#include "../simulation.hpp"
+#include "../utils/config_fcts.hpp"
+#include "../utils/json_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "HeartConfig.hpp"
+#include "HeartEventHandler.hpp"
+#include "ChasteBuildInfo.hpp"
+#include "OutputFileHandler.hpp"
+#include "TrianglesMeshReader.hpp"
+
+// Runs every combination of cell model, mesh and stimulus type of a
+// benchmark file and writes the cost of each phase per node and step
+class UterineBenchmark {
+ private:
+  std::vector<std::string> mCaseNames;  // Name of each case
+  std::vector<toml::value> mCaseOverrides;  // Config overrides of each case
+  std::vector<int> mCaseDims;  // Dimension of each case
+  std::vector<std::string> mCaseMeshPaths;  // Source mesh of each case
+  std::vector<std::string> mResults;  // JSON object of each case that ran
+  double mSimDuration;  // Simulated time of each case (ms)
+  double mStartTime;  // Stimulus onset of every case (ms)
+  unsigned mRepeats;  // Runs of each case, the fastest is kept
+
+  std::string RunCase(unsigned index);
+
+ public:
+  explicit UterineBenchmark(std::string benchmark_file);
+  unsigned GetNumCases();
+  std::string GetCaseName(unsigned index);
+  void Run(std::string output_path = "");
+};
+
+#endif  // INCLUDE_BENCHMARK_UTERINEBENCHMARK_HPP_
@@ -0,0 +1,52 @@
+#ifndef INCLUDE_CACHE_UTERINECOARSEMESH_HPP_
+#define INCLUDE_CACHE_UTERINECOARSEMESH_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <set>
+#include <cmath>
+#include <algorithm>
+
+#include "../toml.hpp"
+#include "../utils/hash_fcts.hpp"
+#include "cache_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "TrianglesMeshWriter.hpp"
+#include "FibreReader.hpp"
+#include "FibreWriter.hpp"
+
+// Coarsened copy of a mesh used to screen sweep points, the nodes within
+// the same cube of side the cluster size are merged into their centroid
+template <unsigned DIM>
+class UterineCoarseMesh {
+ private:
+  std::string mMeshPath;  // Source mesh without extension
+  std::string mMeshName;  // Source mesh name
+  double mClusterSize;  // Side of the cubes of merged nodes, in mesh units
+  std::string mKey;  // Hash of the source mesh files and cluster size
+  std::string mCacheDir;  // Cache folder relative to CHASTE_TEST_OUTPUT
+
+  static double SignedMeasure(const std::vector<std::vector<double>>& rNodes,
+                              const std::vector<unsigned>& rIndices);
+
+ public:
+  UterineCoarseMesh(std::string mesh_path, double cluster_size);
+  std::string GetKey();
+  std::string GetCacheDir();
+  std::string GetCachedMeshPath();
+  bool IsAvailable(bool orthotropic);
+  void Generate(bool orthotropic);
+  std::string GetMeshPath(bool orthotropic);
+};
+
+#include "../../src/cache/UterineCoarseMesh.tpp"
+#endif  // INCLUDE_CACHE_UTERINECOARSEMESH_HPP_
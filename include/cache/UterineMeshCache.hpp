@@ -0,0 +1,40 @@
+#ifndef INCLUDE_CACHE_UTERINEMESHCACHE_HPP_
+#define INCLUDE_CACHE_UTERINEMESHCACHE_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../toml.hpp"
+#include "../utils/hash_fcts.hpp"
+#include "cache_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "TrianglesMeshWriter.hpp"
+#include "FibreReader.hpp"
+#include "FibreWriter.hpp"
+
+template <unsigned DIM>
+class UterineMeshCache {
+ private:
+  std::string mMeshPath;  // Source mesh without extension
+  std::string mMeshName;  // Source mesh name
+  std::string mKey;  // Hash of the source mesh files
+  std::string mCacheDir;  // Cache folder relative to CHASTE_TEST_OUTPUT
+
+ public:
+  explicit UterineMeshCache(std::string mesh_path);
+  std::string GetKey();
+  std::string GetCacheDir();
+  std::string GetCachedMeshPath();
+  bool IsAvailable(bool orthotropic);
+  void Generate(bool orthotropic);
+  std::string GetMeshPath(bool orthotropic);
+};
+
+#include "../../src/cache/UterineMeshCache.tpp"
+#endif  // INCLUDE_CACHE_UTERINEMESHCACHE_HPP_
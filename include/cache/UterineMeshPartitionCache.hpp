@@ -0,0 +1,66 @@
+#ifndef INCLUDE_CACHE_UTERINEMESHPARTITIONCACHE_HPP_
+#define INCLUDE_CACHE_UTERINEMESHPARTITIONCACHE_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "../toml.hpp"
+#include "../utils/hash_fcts.hpp"
+#include "cache_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "HeartConfig.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "TrianglesMeshWriter.hpp"
+#include "FibreReader.hpp"
+#include "FibreWriter.hpp"
+#include <parmetis.h>
+
+template <unsigned DIM>
+class UterineMeshPartitionCache {
+ private:
+  std::string mMeshPath;  // Source mesh without extension
+  std::string mMeshName;  // Source mesh name
+  std::string mPartitioner;  // Partitioning method of the HeartConfig
+  std::string mKey;  // Hash of the source mesh, rank count and partitioner
+  std::string mCacheDir;  // Cache folder relative to CHASTE_TEST_OUTPUT
+  bool mWeighted;  // Balance the node weights rather than the node counts
+  std::vector<double> mNodeWeights;  // Per source node, master process only
+
+  // Chaste only sets the node permutation of the meshes it partitions, this
+  // gives access to it for the meshes read in the partitioned order
+  struct PermutationAccess : public DistributedTetrahedralMesh<DIM, DIM> {
+    static std::vector<unsigned>& rGet(
+        DistributedTetrahedralMesh<DIM, DIM>& rMesh) {
+      return rMesh.*(&PermutationAccess::mNodePermutation);
+    }
+  };
+
+  void Partition(std::vector<unsigned>& rPermutation,
+                 std::vector<unsigned>& rLocalSizes);
+  void PartitionWeighted(std::vector<unsigned>& rPermutation,
+                         std::vector<unsigned>& rLocalSizes);
+
+ public:
+  explicit UterineMeshPartitionCache(std::string mesh_path,
+                                     std::string weights_key = "");
+  void SetNodeWeights(const std::vector<double>& rNodeWeights);
+  std::string GetKey();
+  std::string GetCacheDir();
+  std::string GetCachedMeshPath();
+  std::vector<unsigned> ReadPermutation();
+  bool IsAvailable(bool orthotropic);
+  void Generate(bool orthotropic);
+  std::string GetMeshPath(bool orthotropic);
+  void ConstructMesh(DistributedTetrahedralMesh<DIM, DIM>& rMesh);
+};
+
+#include "../../src/cache/UterineMeshPartitionCache.tpp"
+#endif  // INCLUDE_CACHE_UTERINEMESHPARTITIONCACHE_HPP_
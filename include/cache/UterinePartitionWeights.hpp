@@ -0,0 +1,39 @@
+#ifndef INCLUDE_CACHE_UTERINEPARTITIONWEIGHTS_HPP_
+#define INCLUDE_CACHE_UTERINEPARTITIONWEIGHTS_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include "../utils/hash_fcts.hpp"
+#include "../factories/AbstractUterineCellFactoryTemplate.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "TrianglesMeshReader.hpp"
+
+// Expected cost of each node of a mesh, used to balance the partition
+// between the processes. The weights are only held by the master process.
+template <unsigned DIM>
+class UterinePartitionWeights {
+ private:
+  std::string mMeshPath;  // Source mesh without extension
+  std::vector<double> mWeights;  // Per node of the source mesh
+  std::string mKey;  // Hash of the weights, on all processes
+
+  void SetKey();
+
+ public:
+  explicit UterinePartitionWeights(std::string mesh_path);
+  void ReadCostMap(std::string cost_map_path);
+  void SetRegionCosts(AbstractUterineCellFactoryTemplate<DIM>* pFactory,
+                      const std::vector<double>& rRegionCosts);
+  const std::vector<double>& rGetWeights();
+  std::string GetKey();
+};
+
+#include "../../src/cache/UterinePartitionWeights.tpp"
+#endif  // INCLUDE_CACHE_UTERINEPARTITIONWEIGHTS_HPP_
@@ -0,0 +1,33 @@
+#ifndef INCLUDE_CACHE_UTERINERESULTCACHE_HPP_
+#define INCLUDE_CACHE_UTERINERESULTCACHE_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <filesystem>
+#include <unistd.h>
+
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "cache_fcts.hpp"
+
+class UterineResultCache {
+ private:
+  std::string mKey;  // Hash of everything that defines the results
+  std::string mCacheDir;  // Cache folder relative to CHASTE_TEST_OUTPUT
+
+  static void LinkTree(const std::filesystem::path& source,
+                       const std::filesystem::path& destination);
+
+ public:
+  explicit UterineResultCache(std::string key);
+  std::string GetKey();
+  std::string GetCacheDir();
+  bool IsAvailable();
+  void Store(const std::string& output_dir);
+  void Restore(const std::string& output_dir);
+};
+
+#endif  // INCLUDE_CACHE_UTERINERESULTCACHE_HPP_
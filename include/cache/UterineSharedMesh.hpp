@@ -0,0 +1,28 @@
+#ifndef INCLUDE_CACHE_UTERINESHAREDMESH_HPP_
+#define INCLUDE_CACHE_UTERINESHAREDMESH_HPP_
+
+#include <iostream>
+#include <string>
+
+#include "UterineMeshPartitionCache.hpp"
+#include "HeartConfig.hpp"
+#include "HeartEventHandler.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+
+// Mesh kept in memory between the simulations of a sweep
+template <unsigned DIM>
+class UterineSharedMesh {
+ private:
+  static DistributedTetrahedralMesh<DIM, DIM>* mpMesh;
+  static std::string mMeshPath;  // Mesh file of the shared mesh
+
+ public:
+  static DistributedTetrahedralMesh<DIM, DIM>* Get(
+    std::string mesh_path, std::string partition_source,
+    std::string partition_weights_key = "");
+  static void Clear();
+};
+
+#include "../../src/cache/UterineSharedMesh.tpp"
+#endif  // INCLUDE_CACHE_UTERINESHAREDMESH_HPP_
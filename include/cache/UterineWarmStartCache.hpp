@@ -0,0 +1,38 @@
+#ifndef INCLUDE_CACHE_UTERINEWARMSTARTCACHE_HPP_
+#define INCLUDE_CACHE_UTERINEWARMSTARTCACHE_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "../toml.hpp"
+#include "cache_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "AbstractCvodeCell.hpp"
+#include "../cells/UterineCompactCell.hpp"
+#include "MonodomainProblem.hpp"
+
+template <unsigned DIM>
+class UterineWarmStartCache {
+ private:
+  std::string mKey;  // Hash of the settings that define the tissue state
+  std::string mCacheDir;  // Cache folder relative to CHASTE_TEST_OUTPUT
+
+ public:
+  explicit UterineWarmStartCache(std::string key);
+  std::string GetKey();
+  std::string GetCacheDir();
+  bool IsAvailable();
+  double GetTime();
+  void Save(MonodomainProblem<DIM>& problem);
+  void Load(MonodomainProblem<DIM>& problem);
+};
+
+#include "../../src/cache/UterineWarmStartCache.tpp"
+#endif  // INCLUDE_CACHE_UTERINEWARMSTARTCACHE_HPP_
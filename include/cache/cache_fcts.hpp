@@ -0,0 +1,25 @@
+#ifndef INCLUDE_CACHE_CACHE_FCTS_HPP_
+#define INCLUDE_CACHE_CACHE_FCTS_HPP_
+
+#include <iostream>
+#include <string>
+#include <filesystem>
+#include <system_error>
+#include <unistd.h>
+
+#include "PetscTools.hpp"
+#include "OutputFileHandler.hpp"
+
+
+// Caches are generated in a private folder and moved under their key once
+// complete, so that concurrent runs generating the same cache never read or
+// write each other's files. The folders are relative to CHASTE_TEST_OUTPUT
+// and every process must call the functions. A cache already published
+// under the key is kept, unless replace is set because the new one holds
+// more, such as the fibres of a mesh.
+std::string get_process_tag();
+std::string make_cache_tmp_dir(const std::string& cache_dir);
+void publish_cache_dir(const std::string& tmp_dir,
+                       const std::string& cache_dir, bool replace = false);
+
+#endif  // INCLUDE_CACHE_CACHE_FCTS_HPP_
@@ -0,0 +1,27 @@
+#ifndef INCLUDE_CELLS_UTERINECELLSTATEPOOL_HPP_
+#define INCLUDE_CELLS_UTERINECELLSTATEPOOL_HPP_
+
+#include <memory>
+#include <vector>
+
+// Arena of the state variables of the cells of a process. The values are
+// taken from blocks of the size of many cells, in double or single
+// precision, instead of one heap allocation per cell, and are only freed
+// with the pool.
+class UterineCellStatePool {
+ private:
+  std::vector<std::unique_ptr<unsigned char[]>> mBlocks;
+  unsigned long mBlockSize;  // Bytes per block
+  unsigned long mNumUsed;  // Bytes taken from the last block
+  unsigned long mNumAllocated;  // Bytes of all the blocks
+
+  void* AllocateBytes(unsigned long numBytes);
+
+ public:
+  explicit UterineCellStatePool(unsigned long blockSize);
+  double* Allocate(unsigned size);
+  float* AllocateFloats(unsigned size);
+  unsigned long GetNumBytes() const;
+};
+
+#endif  // INCLUDE_CELLS_UTERINECELLSTATEPOOL_HPP_
@@ -0,0 +1,161 @@
+#ifndef INCLUDE_CELLS_UTERINECOMPACTCELL_HPP_
+#define INCLUDE_CELLS_UTERINECOMPACTCELL_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <nvector/nvector_serial.h>
+#include "Exception.hpp"
+#include "AbstractCvodeCell.hpp"
+#include "AbstractIvpOdeSolver.hpp"
+#include "AbstractStimulusFunction.hpp"
+#include "UterineProfiledCell.hpp"
+#include "UterineCellStatePool.hpp"
+
+// Storage of a cell shared with the other cells of the process: parameter
+// values shared with the cells of the same model until one of its
+// parameters is set for its node only, and state variables in a pool, in
+// double or single precision
+class AbstractUterineCompactCell {
+ protected:
+  // Shared values, empty once the cell has its own copy
+  boost::shared_ptr<std::vector<double>> mpSharedParameters;
+  // Pool of the state variables, empty if the cell has its own
+  boost::shared_ptr<UterineCellStatePool> mpStatePool;
+  // State variables in the pool in double, NULL otherwise
+  double* mpPooledState;
+  // State variables in single precision, NULL if they are in double
+  float* mpFloatState;
+
+  // The single precision state of one cell of the process at a time is
+  // expanded in double in these values, to be solved or read
+  static AbstractUterineCompactCell* mspExpandedCell;
+  static std::vector<double> msExpandedState;
+
+ public:
+  AbstractUterineCompactCell() : mpPooledState(NULL), mpFloatState(NULL) {}
+  virtual ~AbstractUterineCompactCell() {
+    if (mspExpandedCell == this) {
+      mspExpandedCell = NULL;
+    }
+  }
+  bool HasSharedParameters() const { return mpSharedParameters.get() != NULL; }
+  bool HasPooledState() const { return mpStatePool.get() != NULL; }
+  bool HasFloatState() const { return mpFloatState != NULL; }
+  virtual void ShareParameters(
+    boost::shared_ptr<std::vector<double>> pParameters) = 0;
+  virtual void SetPrivateParameter(const std::string& rName,
+                                   double value) = 0;
+  virtual void UseStatePool(boost::shared_ptr<UterineCellStatePool> pPool) = 0;
+  virtual void UseFloatState(
+    boost::shared_ptr<UterineCellStatePool> pPool) = 0;
+  // Make the state variables of the cell readable and writable in double,
+  // the previously expanded cell is rounded back to single precision
+  virtual void ExpandState() = 0;
+  virtual void CompressState() = 0;
+  // To call before using the state variables of any cell of the tissue
+  static void ExpandCellState(AbstractCardiacCellInterface* pCell);
+};
+
+
+// A CellML cell whose parameter and state vectors point to memory shared
+// with other cells, that they keep alive. The shared parameter values are
+// copied before a parameter is set with SetPrivateParameter, SetParameter
+// changes them for all the cells sharing them. Cells with a single
+// precision state expand it before being solved or read by the tissue,
+// other uses of their state must call ExpandState first. A state set or
+// reset by Chaste, which replaces the state vector, is moved back to the
+// pool. Loaded cells have their own copies in double.
+template <class CELL>
+class UterineCompactCell : public CELL,
+                                   public AbstractUterineCompactCell {
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & archive, const unsigned int version) {
+    // The parameter values and the state are saved with the cell by the
+    // base class
+    ExpandState();
+    archive & boost::serialization::base_object<CELL>(*this);
+  }
+
+  void KeepStateStorage();
+
+ public:
+  UterineCompactCell(
+    boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+    boost::shared_ptr<AbstractStimulusFunction> pStimulus);
+  void ShareParameters(
+    boost::shared_ptr<std::vector<double>> pParameters) override;
+  void SetPrivateParameter(const std::string& rName, double value) override;
+  void UseStatePool(boost::shared_ptr<UterineCellStatePool> pPool) override;
+  void UseFloatState(boost::shared_ptr<UterineCellStatePool> pPool) override;
+  void ExpandState() override;
+  void CompressState() override;
+  double GetVoltage() override;
+  void SetVoltage(double voltage) override;
+  double GetIIonic(
+    const std::vector<double>* pStateVariables = NULL) override;
+  void SolveAndUpdateState(double tStart, double tEnd) override;
+  void ComputeExceptVoltage(double tStart, double tEnd) override;
+};
+
+#include "../../src/cells/UterineCompactCell.tpp"
+
+#include "SerializationExportWrapper.hpp"
+// Declare identifiers for the serializer, one per cell model, with and
+// without profiling
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellHodgkinHuxley1952FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellChayKeizer1983FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellMeans2023FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellMeans2023PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellTong2014FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellRoesler2024FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellRoesler2024PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellHodgkinHuxley1952FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellChayKeizer1983FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellMeans2023FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellMeans2023PFromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellTong2014FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellRoesler2024FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellRoesler2024PFromCellMLCvode>>)
+
+namespace boost {
+namespace serialization {
+template<class Archive, class CELL>
+inline void save_construct_data(
+    Archive & ar, const UterineCompactCell<CELL> * t,
+    const unsigned int file_version) {
+  // Same construction data as the CellML cells
+  const boost::shared_ptr<AbstractIvpOdeSolver> p_solver = t->GetSolver();
+  const boost::shared_ptr<AbstractStimulusFunction> p_stimulus =
+    t->GetStimulusFunction();
+  ar << p_solver;
+  ar << p_stimulus;
+}
+
+template<class Archive, class CELL>
+inline void load_construct_data(
+    Archive & ar, UterineCompactCell<CELL> * t,
+    const unsigned int file_version) {
+  boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+  boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
+  ar >> p_solver;
+  ar >> p_stimulus;
+  ::new(t)UterineCompactCell<CELL>(p_solver, p_stimulus);
+}
+}
+}  // namespace boost
+
+#endif  // INCLUDE_CELLS_UTERINECOMPACTCELL_HPP_
@@ -0,0 +1,72 @@
+#ifndef INCLUDE_CELLS_UTERINEPASSIVETISSUECELL_HPP_
+#define INCLUDE_CELLS_UTERINEPASSIVETISSUECELL_HPP_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+#include "AbstractCvodeCell.hpp"
+#include "AbstractIvpOdeSolver.hpp"
+#include "AbstractStimulusFunction.hpp"
+
+// Linear passive membrane of non-excitable tissue. The leak current is the
+// only ionic current and the voltage the only state variable, with the
+// parameters g_leak (mS/cm2), E_leak (mV) and Cm (uF/cm2). The g_p
+// parameter (0, no passive cell) and the v_p derived quantity (the
+// voltage) are the output variables of the passive models, so that they
+// can be used with them.
+class UterinePassiveTissueCell : public AbstractCvodeCell {
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & archive, const unsigned int version) {
+    // This calls serialize on the base class.
+    archive & boost::serialization::base_object<AbstractCvodeCell>(*this);
+  }
+
+ public:
+  UterinePassiveTissueCell(
+    boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+    boost::shared_ptr<AbstractStimulusFunction> pStimulus);
+  double GetIIonic(
+    const std::vector<double>* pStateVariables = NULL) override;
+  void EvaluateYDerivatives(double time, const N_Vector rY,
+                            N_Vector rDY) override;
+  void ComputeExceptVoltage(double tStart, double tEnd) override;
+  N_Vector ComputeDerivedQuantities(double time,
+                                    const N_Vector& rY) override;
+};
+
+#include "SerializationExportWrapper.hpp"
+CHASTE_CLASS_EXPORT(UterinePassiveTissueCell)
+
+namespace boost {
+namespace serialization {
+template<class Archive>
+inline void save_construct_data(
+    Archive & ar, const UterinePassiveTissueCell * t,
+    const unsigned int file_version) {
+  // Same construction data as the CellML cells
+  const boost::shared_ptr<AbstractIvpOdeSolver> p_solver = t->GetSolver();
+  const boost::shared_ptr<AbstractStimulusFunction> p_stimulus =
+    t->GetStimulusFunction();
+  ar << p_solver;
+  ar << p_stimulus;
+}
+
+template<class Archive>
+inline void load_construct_data(
+    Archive & ar, UterinePassiveTissueCell * t,
+    const unsigned int file_version) {
+  boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+  boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
+  ar >> p_solver;
+  ar >> p_stimulus;
+  ::new(t)UterinePassiveTissueCell(p_solver, p_stimulus);
+}
+}
+}  // namespace boost
+
+#endif  // INCLUDE_CELLS_UTERINEPASSIVETISSUECELL_HPP_
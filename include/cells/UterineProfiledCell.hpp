@@ -0,0 +1,103 @@
+#ifndef INCLUDE_CELLS_UTERINEPROFILEDCELL_HPP_
+#define INCLUDE_CELLS_UTERINEPROFILEDCELL_HPP_
+
+#include <chrono>
+#include <boost/shared_ptr.hpp>
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <cvode/cvode.h>
+#include "AbstractCvodeCell.hpp"
+#include "AbstractIvpOdeSolver.hpp"
+#include "AbstractStimulusFunction.hpp"
+#include "HodgkinHuxley1952Cvode.hpp"
+#include "ChayKeizer1983Cvode.hpp"
+#include "Means2023Cvode.hpp"
+#include "Means2023PCvode.hpp"
+#include "Tong2014Cvode.hpp"
+#include "Roesler2024Cvode.hpp"
+#include "Roesler2024PCvode.hpp"
+
+// Work done by a single cell since its creation, on the current process
+class AbstractUterineCellProfile {
+ protected:
+  unsigned long mNumRhsEvaluations;
+  unsigned long mNumCvodeSteps;
+  double mOdeTime;  // Wall time of the cell updates (s)
+
+ public:
+  AbstractUterineCellProfile() :
+    mNumRhsEvaluations(0), mNumCvodeSteps(0), mOdeTime(0.0) {}
+  virtual ~AbstractUterineCellProfile() {}
+  unsigned long GetNumRhsEvaluations() const { return mNumRhsEvaluations; }
+  unsigned long GetNumCvodeSteps() const { return mNumCvodeSteps; }
+  double GetOdeTime() const { return mOdeTime; }
+};
+
+
+// A CellML cell that counts its right-hand side evaluations and CVODE steps
+// and times its updates. Only created when cell profiling is enabled, the
+// counters are not archived.
+template <class CELL>
+class UterineProfiledCell : public CELL, public AbstractUterineCellProfile {
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & archive, const unsigned int version) {
+    // This calls serialize on the base class.
+    archive & boost::serialization::base_object<CELL>(*this);
+  }
+
+ private:
+  void AddSolve(std::chrono::steady_clock::time_point start);
+
+ public:
+  UterineProfiledCell(boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+                      boost::shared_ptr<AbstractStimulusFunction> pStimulus);
+  void EvaluateYDerivatives(double time, const N_Vector rY,
+                            N_Vector rDY) override;
+  void SolveAndUpdateState(double tStart, double tEnd) override;
+  void ComputeExceptVoltage(double tStart, double tEnd) override;
+};
+
+#include "../../src/cells/UterineProfiledCell.tpp"
+
+#include "SerializationExportWrapper.hpp"
+// Declare identifiers for the serializer, one per cell model
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellHodgkinHuxley1952FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellChayKeizer1983FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellMeans2023FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellMeans2023PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellTong2014FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellRoesler2024FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellRoesler2024PFromCellMLCvode>)
+
+namespace boost {
+namespace serialization {
+template<class Archive, class CELL>
+inline void save_construct_data(
+    Archive & ar, const UterineProfiledCell<CELL> * t,
+    const unsigned int file_version) {
+  // Same construction data as the CellML cells
+  const boost::shared_ptr<AbstractIvpOdeSolver> p_solver = t->GetSolver();
+  const boost::shared_ptr<AbstractStimulusFunction> p_stimulus =
+    t->GetStimulusFunction();
+  ar << p_solver;
+  ar << p_stimulus;
+}
+
+template<class Archive, class CELL>
+inline void load_construct_data(
+    Archive & ar, UterineProfiledCell<CELL> * t,
+    const unsigned int file_version) {
+  boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+  boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
+  ar >> p_solver;
+  ar >> p_stimulus;
+  ::new(t)UterineProfiledCell<CELL>(p_solver, p_stimulus);
+}
+}
+}  // namespace boost
+
+#endif  // INCLUDE_CELLS_UTERINEPROFILEDCELL_HPP_
@@ -1,7 +1,13 @@
 #ifndef INCLUDE_CONDUCTIVITY_UTERINECONDUCTIVITYMODIFIER_HPP_
 #define INCLUDE_CONDUCTIVITY_UTERINECONDUCTIVITYMODIFIER_HPP_
 
+#include <chrono>
 #include <iostream>
+#include <string>
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
 
 #include "Exception.hpp"
 #include "AbstractTetrahedralMesh.hpp"
@@ -9,6 +15,31 @@
 #include "distribution_fcts.hpp"
 
 class UterineConductivityModifier : public AbstractConductivityModifier<3, 3> {
+  friend class boost::serialization::access;
+  template<class Archive>
+  void save(Archive & archive, const unsigned int version) const {
+    // The mesh is not saved, it is set again with SetMesh when loading
+    archive & mCentre;
+    archive & mSlope;
+    archive & mBaseline;
+    archive & mAmplitude;
+    archive & mType;
+  }
+  template<class Archive>
+  void load(Archive & archive, const unsigned int version) {
+    archive & mCentre;
+    archive & mSlope;
+    archive & mBaseline;
+    archive & mAmplitude;
+    archive & mType;
+
+    // Rebuild the diagonal from the loaded baseline
+    mSpecialMatrix(0, 0) = mBaseline;
+    mSpecialMatrix(1, 1) = mBaseline;
+    mSpecialMatrix(2, 2) = mBaseline;
+  }
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
  private:
   c_matrix<double, 3, 3> mTensor;
   c_matrix<double, 3, 3> mSpecialMatrix;
@@ -18,6 +49,11 @@ class UterineConductivityModifier : public AbstractConductivityModifier<3, 3> {
   double mAmplitude;
   std::string mType;
   AbstractTetrahedralMesh<3, 3>* mMesh;
+  // Calls and time in ms of the modified tensors of the process, kept here
+  // rather than in an event as the tensor is asked for at each element of
+  // each assembly
+  static unsigned long mNumCalls;
+  static double mElapsedTime;
 
  public:
   UterineConductivityModifier();
@@ -30,6 +66,10 @@ class UterineConductivityModifier : public AbstractConductivityModifier<3, 3> {
     const c_matrix<double, 3, 3>& rOriginalConductivity,
     unsigned domainIndex);
   AbstractTetrahedralMesh<3, 3>* GetMesh();
+  void SetMesh(AbstractTetrahedralMesh<3, 3>* mesh);
+  static void ResetTimer();
+  static unsigned long GetNumCalls();
+  static double GetElapsedTime();
 };
 
 #endif  // INCLUDE_CONDUCTIVITY_UTERINECONDUCTIVITYMODIFIER_HPP_
@@ -6,9 +6,15 @@
 #include <vector>
 #include <cmath>
 #include <unordered_map>
+#include <map>
 
 #include "../toml.hpp"
 #include "../conductivity/distribution_fcts.hpp"
+#include "../utils/config_fcts.hpp"
+#include "../utils/UterineEventHandler.hpp"
+#include "../cells/UterineProfiledCell.hpp"
+#include "../cells/UterineCompactCell.hpp"
+#include "../cells/UterinePassiveTissueCell.hpp"
 #include "MonodomainProblem.hpp"
 #include "ZeroStimulus.hpp"
 #include "HodgkinHuxley1952Cvode.hpp"
@@ -35,7 +41,24 @@ class AbstractUterineCellFactoryTemplate : public AbstractCardiacCellFactory<DIM
   std::unordered_map<std::string, float> mpCell_parameters;
   std::unordered_map<std::string, float> mpPassive_parameters;
   std::int16_t mpCell_id;  // 0 = HH, 1 = CK, 2 = Means, 3 = Tong, 4 = Roesler
+  bool mpProfile_cells;  // Count the work of each cell
+  bool mpShare_parameters;  // Cells share their parameter values
+  bool mpPool_states;  // Cell states are taken from a pool
+  bool mpFloat_states;  // Cell states are stored in single precision
+  // Parameter values shared by the cells of each model
+  std::map<std::string, boost::shared_ptr<std::vector<double>>>
+    mpShared_parameters;
+  boost::shared_ptr<UterineCellStatePool> mpState_pool;
+  // Non-excitable tissue: boxes of the mesh regions (rows: x, y, z start
+  // and end), node attribute of the labelled nodes (-1 for none) and leak
+  std::vector<std::vector<double>> mpPassive_tissue_boxes;
+  int mpPassive_tissue_label;
+  double mpPassive_tissue_g_leak;  // mS/cm2
+  double mpPassive_tissue_e_leak;  // mV
 
+  template <class CELL>
+  AbstractCvodeCell* NewCell(
+    boost::shared_ptr<AbstractStimulusFunction> stimulus);
 
  public:
   AbstractUterineCellFactoryTemplate();
@@ -45,12 +68,24 @@ class AbstractUterineCellFactoryTemplate : public AbstractCardiacCellFactory<DIM
   std::string GetCellParamFile();
   void SetCellParams(AbstractCvodeCell* cell);
   void SetPassiveParams(AbstractCvodeCell* cell, double z);
+  void SetNodeParameter(AbstractCvodeCell* cell, const std::string& name,
+                        double value);
+  bool IsPassiveTissue(Node<DIM>* pNode);
+  AbstractCvodeCell* CreatePassiveTissueCell();
   void InitCell(AbstractCvodeCell*& cell,
                 boost::shared_ptr<AbstractStimulusFunction> stimulus);
   void SetCellType(std::string cell_type);
   void SetEstrus(std::string estrus);
+  void SetProfileCells(bool profile_cells);
+  void SetShareParameters(bool share_parameters);
+  void SetPoolStates(bool pool_states);
+  void SetFloatStates(bool float_states);
+  void SetPassiveTissueLabel(int label);
+  virtual unsigned GetStimulusRegion(const std::vector<double>& rLocation);
   virtual void ReadParams(std::string general_param_file);
   virtual void ReadCellParams(std::string cell_param_file);
+  void ReadPassiveTissueRegions(std::string mesh_param_file,
+                                const std::vector<std::string>& rRegions);
   virtual void PrintParams();
   virtual void WriteLogInfo(std::string log_file);
 };
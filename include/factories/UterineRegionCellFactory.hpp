@@ -27,6 +27,7 @@ class UterineRegionCellFactory : public AbstractUterineCellFactoryTemplate<DIM>
   UterineRegionCellFactory();
   AbstractCvodeCell* CreateCardiacCellForTissueNode(Node<DIM>* pNode);
   unsigned FindRegion(double x, double y, double z);
+  unsigned GetStimulusRegion(const std::vector<double>& rLocation) override;
   unsigned IsInLeft(double x, double y, double z);
   unsigned IsInRight(double x, double y, double z);
   void ReadParams(std::string general_param_file);
@@ -39,6 +40,7 @@ class UterineRegionCellFactory : public AbstractUterineCellFactoryTemplate<DIM>
     double duration,
     double start,
     std::vector<double> region_probs);
+  boost::shared_ptr<UterineRegionSelector> GetSelector();
   void PrintParams() override;
   void WriteLogInfo(std::string log_file);
 };
@@ -22,6 +22,7 @@ class UterineRegularCellFactory : public AbstractUterineCellFactoryTemplate<DIM>
  public:
   UterineRegularCellFactory();
   AbstractCvodeCell* CreateCardiacCellForTissueNode(Node<DIM>* pNode);
+  unsigned GetStimulusRegion(const std::vector<double>& rLocation) override;
   void ReadParams(std::string general_param_file);
   void ReadCellParams(std::string cell_param_file);
   void PrintParams() override;
@@ -22,6 +22,7 @@ class UterineSimpleCellFactory : public AbstractUterineCellFactoryTemplate<DIM>
  public:
   UterineSimpleCellFactory();
   AbstractCvodeCell* CreateCardiacCellForTissueNode(Node<DIM>* pNode);
+  unsigned GetStimulusRegion(const std::vector<double>& rLocation) override;
   void ReadParams(std::string general_param_file);
   void ReadCellParams(std::string cell_param_file);
   void PrintParams() override;
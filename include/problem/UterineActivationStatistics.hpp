@@ -0,0 +1,46 @@
+#ifndef INCLUDE_PROBLEM_UTERINEACTIVATIONSTATISTICS_HPP_
+#define INCLUDE_PROBLEM_UTERINEACTIVATIONSTATISTICS_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "AbstractOutputModifier.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "PetscTools.hpp"
+
+class UterineActivationStatistics : public AbstractOutputModifier {
+ private:
+  double mThreshold;  // Voltage at which a node is activated (mV)
+  unsigned mLow;  // First node owned by this process
+  unsigned mNumRealisations;  // Completed realisations
+  // Per owned node, for the current realisation
+  std::vector<double> mPreviousVoltages;
+  std::vector<double> mActivationTimes;  // First activation, -1 if none
+  // Per owned node, over the completed realisations
+  std::vector<unsigned> mNumActivations;
+  std::vector<double> mMeans;  // Running mean of the activation times
+  std::vector<double> mSquaredDeviations;  // Welford sum of squares
+
+ public:
+  UterineActivationStatistics(const std::string& rFilename, double threshold);
+  void InitialiseAtStart(DistributedVectorFactory* pVectorFactory) override;
+  void FinaliseAtEnd() override;
+  void ProcessSolutionAtTimeStep(double time, Vec solution,
+                                 unsigned problemDim) override;
+  void StartRealisation();
+  double EndRealisation();
+  unsigned GetNumRealisations();
+  double GetActivationTime(unsigned index);
+  double GetActivationProbability(unsigned index);
+  double GetMeanActivationTime(unsigned index);
+  double GetActivationTimeStd(unsigned index);
+  void WriteStatistics(const std::string& file_path,
+                       const std::vector<unsigned>& rPermutation);
+};
+
+#endif  // INCLUDE_PROBLEM_UTERINEACTIVATIONSTATISTICS_HPP_
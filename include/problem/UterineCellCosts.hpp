@@ -0,0 +1,37 @@
+#ifndef INCLUDE_PROBLEM_UTERINECELLCOSTS_HPP_
+#define INCLUDE_PROBLEM_UTERINECELLCOSTS_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "AbstractCardiacCellInterface.hpp"
+#include "PetscTools.hpp"
+#include "../cells/UterineProfiledCell.hpp"
+#include "../utils/UterineRunManifest.hpp"
+
+// Work of the cells owned by this process, read from the profiled cells at
+// the end of a run. Every process must call the write functions.
+class UterineCellCosts {
+ private:
+  unsigned mLow;  // First node owned by this process
+  unsigned mNumProfiled;  // Owned cells that are profiled
+  double mOdeTime;  // ODE event time of this process (s)
+  // Per owned node, 0 for the cells that are not profiled
+  std::vector<double> mCellTimes;
+  std::vector<double> mRhsEvaluations;
+  std::vector<double> mCvodeSteps;
+
+ public:
+  UterineCellCosts(const std::vector<AbstractCardiacCellInterface*>& rCells,
+                   unsigned low, double odeTime);
+  unsigned GetNumProfiled();
+  void WriteCostMap(const std::string& file_path,
+                    const std::vector<unsigned>& rPermutation);
+  void WriteRankCounters(const std::string& file_path,
+                         UterineRunManifest* pManifest);
+};
+
+#endif  // INCLUDE_PROBLEM_UTERINECELLCOSTS_HPP_
@@ -0,0 +1,50 @@
+#ifndef INCLUDE_PROBLEM_UTERINEMEMORYREPORT_HPP_
+#define INCLUDE_PROBLEM_UTERINEMEMORYREPORT_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "AbstractCardiacCellInterface.hpp"
+#include "AbstractCvodeCell.hpp"
+#include "PetscTools.hpp"
+#include "../cells/UterineCompactCell.hpp"
+#include "../utils/UterineRunManifest.hpp"
+
+// Memory of the cells of one model on this process (bytes)
+struct UterineCellModelMemory {
+  unsigned numCells;
+  unsigned numSharedCells;  // Cells without their own parameter values
+  unsigned long stateBytes;  // Per cell
+  unsigned long parameterBytes;  // Per cell
+  unsigned long cvodeBytes;  // Per cell
+};
+
+// Memory used by the cells, mesh and linear system of each process after
+// Initialise. The sizes are computed from the numbers of variables, nodes
+// and non-zeros, the allocator overhead is not counted. Every process must
+// call the write functions.
+class UterineMemoryReport {
+ private:
+  std::map<std::string, UterineCellModelMemory> mModels;
+  unsigned long mMeshBytes;
+  unsigned long mMatrixBytes;  // System and mass matrices
+  unsigned long mVectorBytes;  // Distributed and replicated vectors
+
+  static std::string FormatMb(double bytes);
+
+ public:
+  explicit UterineMemoryReport(
+    const std::vector<AbstractCardiacCellInterface*>& rCells);
+  void SetMeshBytes(unsigned long meshBytes);
+  void SetLinearSystem(unsigned numOwnedRows, unsigned long numNonZeros,
+                       unsigned numGlobalRows);
+  void Write(const std::string& log_path, UterineRunManifest* pManifest);
+  static double GetPeakRss();
+  static void WritePeakRss(const std::string& log_path);
+};
+
+#endif  // INCLUDE_PROBLEM_UTERINEMEMORYREPORT_HPP_
@@ -0,0 +1,36 @@
+#ifndef INCLUDE_PROBLEM_UTERINEMONODOMAINPROBLEM_HPP_
+#define INCLUDE_PROBLEM_UTERINEMONODOMAINPROBLEM_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+
+#include "MonodomainProblem.hpp"
+#include "AbstractCardiacCellFactory.hpp"
+#include "PetscTools.hpp"
+
+template <unsigned DIM>
+class UterineMonodomainProblem : public MonodomainProblem<DIM> {
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & archive, const unsigned int version) {
+    // This calls serialize on the base class.
+    archive & boost::serialization::base_object<MonodomainProblem<DIM>>(*this);
+  }
+
+ public:
+  explicit UterineMonodomainProblem(
+    AbstractCardiacCellFactory<DIM>* pCellFactory);
+  UterineMonodomainProblem();  // Used when loading from an archive
+  void SetCurrentTime(double time);
+  void Restart(double time = 0.0);
+  bool GetPrintOutput();
+  AbstractCardiacCellFactory<DIM>* GetCellFactory();
+};
+
+#include "../../src/problem/UterineMonodomainProblem.tpp"
+
+#include "SerializationExportWrapper.hpp"
+// Declare identifier for the serializer
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(UterineMonodomainProblem)
+
+#endif  // INCLUDE_PROBLEM_UTERINEMONODOMAINPROBLEM_HPP_
@@ -0,0 +1,63 @@
+#ifndef INCLUDE_PROBLEM_UTERINEPROGRESSREPORT_HPP_
+#define INCLUDE_PROBLEM_UTERINEPROGRESSREPORT_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <unistd.h>
+
+#include "AbstractOutputModifier.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "PetscTools.hpp"
+#include "../utils/json_fcts.hpp"
+
+// Progress of the simulation at the printing times. The master process
+// prints a line at most every line period of wall time, and rewrites the
+// status file every given number of printing steps. The time going back
+// (next realisation) starts a new run. Every process must process the
+// steps.
+class UterineProgressReport : public AbstractOutputModifier {
+ private:
+  std::string mStatusPath;  // Empty for no status file
+  double mEndTime;  // End of the runs (ms)
+  double mPdeTimestep;  // ms
+  unsigned mNumNodes;
+  double mThreshold;  // Voltage above which a cell is active (mV)
+  double mLinePeriod;  // Wall time between two lines (s), 0 for no lines
+  unsigned mStatusSteps;  // Printing steps between two status files
+  std::chrono::steady_clock::time_point mStart;
+  std::chrono::steady_clock::time_point mRunStart;
+  double mRunStartTime;  // Simulated time at the start of the run (ms)
+  double mTime;  // Last simulated time (ms)
+  double mLastLine;  // Wall time of the last line (s)
+  unsigned mNumRuns;
+  unsigned mNumSteps;  // Printing steps of the run
+  double mActiveFraction;
+
+  double GetWallTime(std::chrono::steady_clock::time_point start) const;
+  static std::string FormatDuration(double seconds);
+  void WriteLine() const;
+  void WriteStatus() const;
+
+ public:
+  UterineProgressReport(const std::string& rStatusPath, double endTime,
+                        double pdeTimestep, unsigned numNodes,
+                        double threshold, double linePeriod,
+                        unsigned statusSteps);
+  void InitialiseAtStart(DistributedVectorFactory* pVectorFactory) override;
+  void FinaliseAtEnd() override;
+  void ProcessSolutionAtTimeStep(double time, Vec solution,
+                                 unsigned problemDim) override;
+  unsigned GetNumRuns() const;
+  double GetActiveFraction() const;
+  double GetNodeStepsPerSecond() const;
+  double GetRemainingTime() const;
+};
+
+#endif  // INCLUDE_PROBLEM_UTERINEPROGRESSREPORT_HPP_
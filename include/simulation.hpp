@@ -2,18 +2,89 @@
 #define INCLUDE_SIMULATION_HPP_
 
 #include <iostream>
+#include <sstream>
+#include <climits>
+#include <chrono>
+#include <map>
+#include <set>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include "CheckpointArchiveTypes.hpp"
 #include "Exception.hpp"
 #include "PetscException.hpp"
 #include "OutputFileHandler.hpp"
+#include "OutputDirectoryFifoQueue.hpp"
+#include "FileFinder.hpp"
+#include "ArchiveOpener.hpp"
+#include "TimeStepper.hpp"
+#include "CardiacSimulationArchiver.hpp"
+#include "ChasteBuildInfo.hpp"
 
 #include "factories/UterineSimpleCellFactory.hpp"
 #include "factories/UterineRegularCellFactory.hpp"
 #include "factories/UterineZeroCellFactory.hpp"
 #include "factories/UterineRegionCellFactory.hpp"
 #include "conductivity/UterineConductivityModifier.hpp"
+#include "problem/UterineMonodomainProblem.hpp"
+#include "problem/UterineActivationStatistics.hpp"
+#include "problem/UterineCellCosts.hpp"
+#include "problem/UterineMemoryReport.hpp"
+#include "problem/UterineProgressReport.hpp"
+#include "cache/UterineWarmStartCache.hpp"
+#include "cache/UterineMeshCache.hpp"
+#include "cache/UterineCoarseMesh.hpp"
+#include "cache/UterineMeshPartitionCache.hpp"
+#include "cache/UterinePartitionWeights.hpp"
+#include "cache/UterineSharedMesh.hpp"
+#include "cache/UterineResultCache.hpp"
+#include "utils/hash_fcts.hpp"
+#include "utils/UterineRunManifest.hpp"
+#include "utils/UterineEventHandler.hpp"
+#include "utils/UterineSamplingProfiler.hpp"
+#include "utils/config_fcts.hpp"
 
-void run_simulation(const int dim);
-void simulation_2d(std::string stimulus_type, std::string log_path);
-void simulation_3d(std::string stimulus_type, std::string log_path);
+struct SimulationSettings {
+  std::string stimulus_type;  // Regular, simple, region or zero stimulus
+  std::string log_path;  // Log file of the simulation
+  std::string resume_dir;  // Checkpoint to resume from, empty if none
+  std::string warm_start_key;  // Warm start cache key, empty if disabled
+  double warm_start_time;  // Time at which the warm start state is saved
+  std::string partition_source;  // Mesh of the cached partition, empty if none
+  std::string partition_weights_key;  // Hash of the partition weights, if any
+  std::string mesh_path;  // Mesh file used by the simulation
+  bool reuse_mesh;  // Keep the mesh in memory for the next simulations
+  unsigned monte_carlo_runs;  // Region stimulus realisations, 0 if disabled
+  unsigned region_seed;  // Seed the realisation streams are derived from
+  double activation_threshold;  // Voltage of the activation statistics (mV)
+  bool activation_map;  // Write the activation times of single runs
+  bool cell_profiling;  // Write the cost of each cell and process
+  bool memory_report;  // Report the memory use after initialisation
+  double progress_interval;  // Wall time between progress lines (s), 0 if none
+  unsigned status_steps;  // Printing steps between status files, 0 if none
+  double rest_check_interval;  // Time between rest checks, 0 if disabled
+  double rest_threshold;  // Voltage below which the tissue is at rest (mV)
+  double stimulus_start;  // Stimulus onset (ms)
+  double stimulus_period;  // Time between stimuli for periodic stimuli (ms)
+  double stimulus_duration;  // Duration of each stimulus (ms)
+  UterineRunManifest* manifest;  // Filled with the mesh size and timings
+};
+
+void run_simulation(const int dim, std::string resume_dir = "",
+                    bool reuse_mesh = false);
+void simulation_2d(const SimulationSettings& settings);
+void simulation_3d(const SimulationSettings& settings);
+bool stimulus_pending(const SimulationSettings& settings, double time,
+                      double end_time);
+void save_modifier(UterineConductivityModifier* modifier,
+                   std::string archive_dir);
+bool load_modifier(UterineConductivityModifier& modifier,
+                   std::string archive_dir);
+std::string warm_start_key(const int dim, const toml::value& sys_params,
+                           const toml::value& cell_params,
+                           std::string mesh_path, double warm_start_time);
+std::string result_cache_key(const int dim, const toml::value& sys_params,
+                             const toml::value& cell_params,
+                             std::string mesh_path);
 
 #endif  // INCLUDE_SIMULATION_HPP_
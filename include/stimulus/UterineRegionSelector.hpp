@@ -7,28 +7,55 @@
 #include <random>
 #include <vector>
 #include <cmath>
+#include <sstream>
+#include <string>
 
 #include "ChasteSerialization.hpp"
 #include <boost/serialization/base_object.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
 
 #include "AbstractStimulusFunction.hpp"
 
 class UterineRegionSelector : public AbstractStimulusFunction {
     friend class boost::serialization::access;
     template<class Archive>
-    void serialize(Archive & archive, const unsigned int version) {
+    void save(Archive & archive, const unsigned int version) const {
         // This calls serialize on the base class.
         archive & boost::serialization::base_object<AbstractStimulusFunction>(*this);
         archive & mpCurrentRegion;
         archive & mpOvariesProb;
         archive & mpCentreProb;
         archive & mpCervicalProb;
+
+        // Save the position of the random number generator
+        std::ostringstream generator_state;
+        generator_state << mpGenerator;
+        std::string generator_string = generator_state.str();
+        archive & generator_string;
+    }
+    template<class Archive>
+    void load(Archive & archive, const unsigned int version) {
+        archive & boost::serialization::base_object<AbstractStimulusFunction>(*this);
+        archive & mpCurrentRegion;
+        archive & mpOvariesProb;
+        archive & mpCentreProb;
+        archive & mpCervicalProb;
+
+        // Restore the random number generator where it was saved
+        std::string generator_string;
+        archive & generator_string;
+        std::istringstream generator_state(generator_string);
+        generator_state >> mpGenerator;
     }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
  private:
     unsigned mpCurrentRegion;  // Current region for stimulus
     double mpOvariesProb;
     double mpCentreProb;
     double mpCervicalProb;
+    std::mt19937 mpGenerator;  // Random number generator
 
  public:
     UterineRegionSelector();
@@ -37,6 +64,8 @@ class UterineRegionSelector : public AbstractStimulusFunction {
     void SetRegionProbs(const std::vector<double>& region_probs);
     unsigned GetCurrentRegion();
     void SetCurrentRegion(unsigned region);
+    void SetSeed(unsigned seed);
+    void SetStream(unsigned seed, unsigned stream);
 };
 
 #include "SerializationExportWrapper.hpp"
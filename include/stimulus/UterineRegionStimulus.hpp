@@ -6,10 +6,24 @@
 #include <vector>
 #include <boost/shared_ptr.hpp>
 
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
 #include "RegularStimulus.hpp"
 #include "UterineRegionSelector.hpp"
 
 class UterineRegionStimulus : public RegularStimulus {
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version) {
+        // This calls serialize on the base class.
+        archive & boost::serialization::base_object<RegularStimulus>(*this);
+        archive & mpRegion;
+        // The selector is shared between the region stimuli, boost keeps
+        // track of the pointer so it is only restored once
+        archive & mpSelector;
+    }
  private:
     double mpRegion;
     boost::shared_ptr<UterineRegionSelector> mpSelector;
@@ -21,6 +35,22 @@ class UterineRegionStimulus : public RegularStimulus {
     double GetStimulus(double time) override;
     void SetRegionProbs(const std::vector<double> regionProbs);
     void SetRegion(const unsigned region);
+    boost::shared_ptr<UterineRegionSelector> GetSelector();
 };
 
+#include "SerializationExportWrapper.hpp"
+// Declare identifier for the serializer
+CHASTE_CLASS_EXPORT(UterineRegionStimulus)
+namespace boost {
+namespace serialization {
+template<class Archive>
+inline void load_construct_data(
+    Archive & ar, UterineRegionStimulus * t, const unsigned int file_version) {
+     // Values are overwritten when the stimulus is loaded
+     ::new(t)UterineRegionStimulus(
+       0.0, 0.0, 1.0, 0.0, boost::shared_ptr<UterineRegionSelector>());
+}
+}
+}  // namespace boost
+
 #endif  // INCLUDE_STIMULUS_UTERINEREGIONSTIMULUS_HPP_
@@ -0,0 +1,50 @@
+#ifndef INCLUDE_SWEEP_UTERINESWEEP_HPP_
+#define INCLUDE_SWEEP_UTERINESWEEP_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+
+#include "../toml.hpp"
+#include "../simulation.hpp"
+#include "../utils/config_fcts.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "OutputFileHandler.hpp"
+#include "TrianglesMeshReader.hpp"
+
+class UterineSweep {
+ private:
+  int mDim;  // Dimension of the simulations
+  std::vector<std::string> mPointNames;  // Name of each sweep point
+  std::vector<toml::value> mPointOverrides;  // Config overrides of each point
+  std::vector<std::string> mFailedPoints;  // Points that threw an exception
+  double mScreeningCoarsening;  // Cluster size of the screening mesh, 0 if off
+  double mMinActivatedFraction;  // Tissue to activate to pass the screening
+  bool mHasTarget;  // A target region must be activated to pass
+  std::vector<double> mTargetMin;  // Lower corner of the target region
+  std::vector<double> mTargetMax;  // Upper corner of the target region
+  std::vector<std::string> mScreenedOutPoints;  // Points that did not pass
+
+  void AddGrid(const std::string& name, const toml::value& overrides,
+               const toml::value& grid);
+  toml::value GetOverrides(unsigned index, bool screening);
+
+ public:
+  UterineSweep(int dim, std::string sweep_file);
+  unsigned GetNumPoints();
+  std::string GetPointName(unsigned index);
+  const toml::value& GetPointOverrides(unsigned index);
+  bool IsScreening();
+  bool IsPromoted(unsigned index);
+  void RunPoint(unsigned index, bool screening = false);
+  bool TryRunPoint(unsigned index, bool screening = false);
+  void Finish();
+  void Run();
+};
+
+#endif  // INCLUDE_SWEEP_UTERINESWEEP_HPP_
@@ -0,0 +1,42 @@
+#ifndef INCLUDE_SWEEP_UTERINESWEEPSCHEDULER_HPP_
+#define INCLUDE_SWEEP_UTERINESWEEPSCHEDULER_HPP_
+
+#include <iostream>
+#include <string>
+#include <mpi.h>
+#include <petsc.h>
+
+#include "UterineSweep.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+// Runs the points of a sweep concurrently on groups of processes, each
+// group sees its own sub-communicator as PETSC_COMM_WORLD
+class UterineSweepScheduler {
+ private:
+  static bool mInitialisedMpi;  // MPI was initialised before PETSc
+  static unsigned mGroupSize;  // Processes per group, 0 if not split
+  static int mGroupIndex;  // Index of the group of this process
+  static int mNumGroups;  // Number of groups
+
+  MPI_Win mCounterWindow;  // Shared counter of the next point to run
+  int* mpCounter;  // Counter memory, only allocated on the first process
+
+  int GetNextPoint();
+  void ResetQueue();
+  void RunQueue(UterineSweep& sweep, bool screening);
+
+ public:
+  static void InitialiseGroups(int* pArgc, char*** pArgv,
+                               unsigned group_size);
+  static void FinaliseGroups();
+  static unsigned GetGroupSize();
+  static int GetGroupIndex();
+  static int GetNumGroups();
+
+  UterineSweepScheduler();
+  ~UterineSweepScheduler();
+  void Run(UterineSweep& sweep);
+};
+
+#endif  // INCLUDE_SWEEP_UTERINESWEEPSCHEDULER_HPP_
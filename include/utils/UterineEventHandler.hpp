@@ -0,0 +1,35 @@
+#ifndef INCLUDE_UTILS_UTERINEEVENTHANDLER_HPP_
+#define INCLUDE_UTILS_UTERINEEVENTHANDLER_HPP_
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "GenericEventHandler.hpp"
+#include "HeartEventHandler.hpp"
+#include "PetscTools.hpp"
+#include "../conductivity/UterineConductivityModifier.hpp"
+
+// Timers of the uterine code paths, reported as extra columns of the
+// HeartEventHandler report. The cell events run within its initialisation.
+// The conductivity modifier keeps its own time as it runs per element.
+class UterineEventHandler : public GenericEventHandler<8, UterineEventHandler> {
+ public:
+  static const char* EventName[8];
+
+  typedef enum {
+    READ_CONFIG = 0,  // TOML parsing of the configuration files
+    CREATE_ZERO_CELL,  // CreateCardiacCellForTissueNode of each factory
+    CREATE_SIMPLE_CELL,
+    CREATE_REGULAR_CELL,
+    CREATE_REGION_CELL,
+    FIND_REGION,  // Stimulus region of a node
+    SET_PASSIVE_PARAMS,  // Passive conductance of a cell
+    EVERYTHING
+  } EventType;
+
+  static void ReportWithHeart();
+};
+
+#endif  // INCLUDE_UTILS_UTERINEEVENTHANDLER_HPP_
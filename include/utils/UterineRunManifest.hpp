@@ -0,0 +1,37 @@
+#ifndef INCLUDE_UTILS_UTERINERUNMANIFEST_HPP_
+#define INCLUDE_UTILS_UTERINERUNMANIFEST_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <sys/resource.h>
+
+#include "../toml.hpp"
+#include "json_fcts.hpp"
+#include "PetscTools.hpp"
+#include "HeartEventHandler.hpp"
+#include "UterineEventHandler.hpp"
+
+class UterineRunManifest {
+ private:
+  // Top level entries as keys and JSON values, in insertion order
+  std::vector<std::pair<std::string, std::string>> mEntries;
+  // Wall time of the phases in s, on the current process
+  std::vector<std::pair<std::string, double>> mPhaseTimes;
+
+ public:
+  UterineRunManifest();
+  void SetEntry(const std::string& key, const std::string& json_value);
+  void SetString(const std::string& key, const std::string& value);
+  void SetNumber(const std::string& key, double value);
+  void SetConfig(const std::string& key, const toml::value& config);
+  void SetMeshSize(unsigned num_nodes, unsigned num_elements);
+  void AddPhaseTime(const std::string& phase, double time);
+  void AddHeartEventTimes();
+  void AddUterineEventTimes();
+  void Write(const std::string& file_path);
+};
+
+#endif  // INCLUDE_UTILS_UTERINERUNMANIFEST_HPP_
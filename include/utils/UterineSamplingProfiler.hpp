@@ -0,0 +1,37 @@
+#ifndef INCLUDE_UTILS_UTERINESAMPLINGPROFILER_HPP_
+#define INCLUDE_UTILS_UTERINESAMPLINGPROFILER_HPP_
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <signal.h>
+
+// Sampling profiler of the process. A timer signal interrupts it at a
+// fixed interval of its CPU time, the call stack is then recorded in a
+// buffer allocated at start, and the stacks are written at the end in the
+// collapsed format of flame graphs. Needs no privileges or external tool,
+// only one profiler can run per process.
+class UterineSamplingProfiler {
+ private:
+  static const unsigned MAX_DEPTH = 64;  // Frames kept per sample
+  // Samples as their number of frames followed by the return addresses,
+  // 0 after the last sample
+  static std::vector<void*> msBuffer;
+  static std::atomic<unsigned long> msNumUsed;
+  static std::atomic<unsigned long> msNumSamples;
+  static std::atomic<unsigned long> msNumDropped;  // Buffer full
+  static struct sigaction msPreviousAction;
+  static bool msRunning;
+
+  static void HandleSignal(int signal, siginfo_t* pInfo, void* pContext);
+  static std::string GetFrameName(void* pAddress, bool isLeaf);
+
+ public:
+  static void Start(double interval, unsigned long bufferBytes);
+  static void Stop();
+  static unsigned long GetNumSamples();
+  static unsigned long GetNumDropped();
+  static void Write(const std::string& file_path);
+};
+
+#endif  // INCLUDE_UTILS_UTERINESAMPLINGPROFILER_HPP_
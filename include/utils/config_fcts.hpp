@@ -0,0 +1,48 @@
+#ifndef INCLUDE_UTILS_CONFIG_FCTS_HPP_
+#define INCLUDE_UTILS_CONFIG_FCTS_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdlib>
+
+#include "../toml.hpp"
+#include "Exception.hpp"
+#include "UterineEventHandler.hpp"
+
+
+// Overrides applied on top of the config files, as a table with one
+// sub-table per section (general, cell and mesh)
+void set_config_overrides(const toml::value& overrides);
+void clear_config_overrides();
+const toml::value& get_config_overrides();
+
+// Overrides set for the lifetime of the object, the previous ones are
+// restored when it goes out of scope, exceptions included
+class ScopedConfigOverrides {
+ private:
+  toml::value mPreviousOverrides;
+
+ public:
+  explicit ScopedConfigOverrides(const toml::value& overrides);
+  ~ScopedConfigOverrides();
+  ScopedConfigOverrides(const ScopedConfigOverrides&) = delete;
+  ScopedConfigOverrides& operator=(const ScopedConfigOverrides&) = delete;
+};
+
+// General config file replacing the default one of the dimension, empty
+// to use the default
+void set_general_config_file(const std::string& config_path);
+const std::string& get_general_config_file();
+toml::value read_config(const std::string& config_path,
+                        const std::string& section);
+void merge_toml(toml::value& base, const toml::value& overrides);
+std::string find_config_file(const std::string& config_file);
+void set_toml_path(toml::value& table, const std::string& dotted_key,
+                   const toml::value& value);
+void add_config_override(toml::value& overrides,
+                         const std::string& assignment);
+
+#endif  // INCLUDE_UTILS_CONFIG_FCTS_HPP_
@@ -0,0 +1,30 @@
+#ifndef INCLUDE_UTILS_HASH_FCTS_HPP_
+#define INCLUDE_UTILS_HASH_FCTS_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <sys/stat.h>
+
+#include "../toml.hpp"
+#include "Exception.hpp"
+
+
+// 64 bit FNV-1a hashes used to build the cache keys
+std::uint64_t hash_string(const std::string& value,
+                          std::uint64_t seed = 14695981039346656037ULL);
+std::uint64_t hash_file(const std::string& file_path,
+                        std::uint64_t seed = 14695981039346656037ULL);
+std::uint64_t hash_file_stats(const std::string& file_path,
+                              std::uint64_t seed = 14695981039346656037ULL);
+std::uint64_t hash_toml(const toml::value& value,
+                        std::uint64_t seed = 14695981039346656037ULL);
+std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value);
+std::string hash_to_string(std::uint64_t hash);
+
+#endif  // INCLUDE_UTILS_HASH_FCTS_HPP_
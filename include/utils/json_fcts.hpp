@@ -0,0 +1,20 @@
+#ifndef INCLUDE_UTILS_JSON_FCTS_HPP_
+#define INCLUDE_UTILS_JSON_FCTS_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "../toml.hpp"
+
+
+// Helpers to write the run manifests without a JSON library
+std::string json_string(const std::string& value);
+std::string json_number(double value);
+std::string toml_to_json(const toml::value& value);
+
+#endif  // INCLUDE_UTILS_JSON_FCTS_HPP_
@@ -0,0 +1,306 @@
+#include "../../include/benchmark/UterineBenchmark.hpp"
+
+namespace {
+template <unsigned DIM>
+unsigned read_num_nodes(const std::string& mesh_path) {
+  TrianglesMeshReader<DIM, DIM> mesh_reader(mesh_path);
+  return mesh_reader.GetNumNodes();
+}
+}  // namespace
+
+
+UterineBenchmark::UterineBenchmark(std::string benchmark_file) {
+  const std::string benchmark_path = find_config_file(benchmark_file);
+  const auto benchmark = toml::parse(benchmark_path);
+  const auto cell_types = toml::find<std::vector<std::string>>(benchmark,
+                                                               "cell_types");
+  const auto stimulus_types = toml::find<std::vector<std::string>>(
+    benchmark, "stimulus_types");
+  mSimDuration = toml::find_or<double>(benchmark, "sim_duration", 1000.0);
+  mRepeats = toml::find_or<unsigned>(benchmark, "repeats", 1);
+  // The cell types start their stimulus at different times, some after the
+  // end of the cases
+  mStartTime = toml::find_or<double>(benchmark, "start_time", 100.0);
+
+  if (mStartTime >= mSimDuration) {
+    const std::string err_msg = "Benchmark " + benchmark_path +
+      " stimulus starts after the end of the cases";
+    const std::string err_filename = "UterineBenchmark.cpp";
+    unsigned line_number = 29;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  for (const auto& mesh : toml::find(benchmark, "meshes").as_array()) {
+    const std::string mesh_dir = toml::find<std::string>(mesh, "mesh_dir");
+    const std::string mesh_name = toml::find<std::string>(mesh, "mesh_name");
+    const int dim = toml::find_or<int>(mesh, "dim", 3);
+    // Meshes without a mesh configuration file have no stimulus regions
+    const auto mesh_stimulus_types = toml::find_or<std::vector<std::string>>(
+      mesh, "stimulus_types", stimulus_types);
+    // Each partition weighting is a separate case, to compare the imbalance
+    const auto partition_weights = toml::find_or<std::vector<std::string>>(
+      mesh, "partition_weights", std::vector<std::string>{"none"});
+
+    for (const auto& cell_type : cell_types) {
+      for (const auto& stimulus_type : mesh_stimulus_types) {
+        for (const auto& weights : partition_weights) {
+          toml::value overrides = toml::table{};
+          set_toml_path(overrides, "general.cell_type",
+                        toml::value(cell_type));
+          set_toml_path(overrides, "general.stimulus_type",
+                        toml::value(stimulus_type));
+          set_toml_path(overrides, "general.mesh_dir",
+                        toml::value(mesh_dir));
+          set_toml_path(overrides, "general.mesh_name",
+                        toml::value(mesh_name));
+          set_toml_path(overrides, "general.orthotropic", toml::value(
+            toml::find_or<bool>(mesh, "orthotropic", false)));
+          set_toml_path(overrides, "general.sim_duration",
+                        toml::value(mSimDuration));
+          set_toml_path(overrides, "cell.start_time",
+                        toml::value(mStartTime));
+          set_toml_path(overrides, "general.save_dir",
+                        toml::value("benchmark/" + mesh_name));
+
+          // Every case runs the full simulation with its output
+          set_toml_path(overrides, "general.checkpoint_timestep",
+                        toml::value(0.0));
+          set_toml_path(overrides, "general.warm_start", toml::value(false));
+          set_toml_path(overrides, "general.result_cache", toml::value(false));
+          set_toml_path(overrides, "general.early_stop", toml::value(false));
+          set_toml_path(overrides, "general.monte_carlo_runs", toml::value(0));
+          set_toml_path(overrides, "general.coarsening", toml::value(0.0));
+          set_toml_path(overrides, "general.activation_map",
+                        toml::value(false));
+          set_toml_path(overrides, "general.partition_weights",
+                        toml::value(weights));
+
+          mCaseNames.push_back(cell_type + "_" + mesh_name + "_" +
+                               stimulus_type +
+                               (weights == "none" ? "" : "_" + weights));
+          mCaseOverrides.push_back(overrides);
+          mCaseDims.push_back(dim);
+          mCaseMeshPaths.push_back(getenv("CHASTE_SOURCE_DIR") + mesh_dir +
+                                   mesh_name);
+        }
+      }
+    }
+  }
+
+  if (mCaseNames.empty()) {
+    const std::string err_msg = "Benchmark " + benchmark_path +
+      " has no cases";
+    const std::string err_filename = "UterineBenchmark.cpp";
+    unsigned line_number = 94;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+}
+
+
+unsigned UterineBenchmark::GetNumCases() {
+  return mCaseNames.size();
+}
+
+
+std::string UterineBenchmark::GetCaseName(unsigned index) {
+  return mCaseNames.at(index);
+}
+
+
+std::string UterineBenchmark::RunCase(unsigned index) {
+  // Fastest run of the ode, assembly, solve, output and cell creation
+  // phases, and of the whole run, each on the slowest process
+  const unsigned num_times = 6;
+  std::vector<double> best_times(num_times,
+                                 std::numeric_limits<double>::infinity());
+  // Slowest over average process ODE time, of the run with the fastest ODEs
+  double ode_imbalance = 1.0;
+  const toml::value base_overrides = get_config_overrides();
+  toml::value overrides = base_overrides;
+  merge_toml(overrides, mCaseOverrides.at(index));
+  set_config_overrides(overrides);
+
+  try {
+    for (unsigned repeat = 0; repeat < mRepeats; ++repeat) {
+      const auto run_start = std::chrono::steady_clock::now();
+      // The mesh is kept in memory for the next cases
+      run_simulation(mCaseDims.at(index), "", true);
+      const std::chrono::duration<double> wall_time =
+        std::chrono::steady_clock::now() - run_start;
+
+      // The event handler is only reset by the next run, times are in ms
+      double local_times[num_times] = {
+        HeartEventHandler::GetElapsedTime(HeartEventHandler::SOLVE_ODES)/1000,
+        (HeartEventHandler::GetElapsedTime(HeartEventHandler::ASSEMBLE_SYSTEM) +
+         HeartEventHandler::GetElapsedTime(HeartEventHandler::ASSEMBLE_RHS)) /
+        1000,
+        HeartEventHandler::GetElapsedTime(
+          HeartEventHandler::SOLVE_LINEAR_SYSTEM)/1000,
+        (HeartEventHandler::GetElapsedTime(HeartEventHandler::WRITE_OUTPUT) +
+         HeartEventHandler::GetElapsedTime(HeartEventHandler::DATA_CONVERSION)) /
+        1000,
+        HeartEventHandler::GetElapsedTime(HeartEventHandler::INITIALISE)/1000,
+        wall_time.count()};
+      double max_times[num_times];
+      MPI_Allreduce(local_times, max_times, num_times, MPI_DOUBLE, MPI_MAX,
+                    PETSC_COMM_WORLD);
+      double total_ode_time;
+      MPI_Allreduce(local_times, &total_ode_time, 1, MPI_DOUBLE, MPI_SUM,
+                    PETSC_COMM_WORLD);
+
+      if (max_times[0] < best_times[0] && total_ode_time > 0.0) {
+        ode_imbalance = max_times[0] * PetscTools::GetNumProcs() /
+          total_ode_time;
+      }
+
+      for (unsigned i = 0; i < num_times; ++i) {
+        best_times[i] = std::min(best_times[i], max_times[i]);
+      }
+    }
+  } catch (const Exception&) {
+    set_config_overrides(base_overrides);
+    throw;
+  }
+  set_config_overrides(base_overrides);
+
+  // Peak resident memory of the largest process, since the start of the
+  // benchmark as it only grows
+  const double local_rss = UterineMemoryReport::GetPeakRss();
+  double peak_rss;
+  MPI_Allreduce(&local_rss, &peak_rss, 1, MPI_DOUBLE, MPI_MAX,
+                PETSC_COMM_WORLD);
+
+  // The time steps of the run are kept in HeartConfig until the next one
+  const double num_nodes = mCaseDims.at(index) == 2 ?
+    read_num_nodes<2>(mCaseMeshPaths.at(index)) :
+    read_num_nodes<3>(mCaseMeshPaths.at(index));
+  const double num_steps = std::round(
+    mSimDuration / HeartConfig::Instance()->GetPdeTimeStep());
+  const double num_prints = std::round(
+    mSimDuration / HeartConfig::Instance()->GetPrintingTimeStep());
+  const double node_steps = num_nodes * num_steps;
+  const toml::value& general = toml::find(mCaseOverrides.at(index),
+                                          "general");
+
+  std::ostringstream json_stream;
+  json_stream << "    {" << std::endl
+    << "      \"name\": " << json_string(mCaseNames.at(index)) << ","
+    << std::endl
+    << "      \"status\": \"ok\"," << std::endl
+    << "      \"cell_type\": " << json_string(
+      toml::find<std::string>(general, "cell_type")) << "," << std::endl
+    << "      \"mesh\": " << json_string(
+      toml::find<std::string>(general, "mesh_name")) << "," << std::endl
+    << "      \"stimulus_type\": " << json_string(
+      toml::find<std::string>(general, "stimulus_type")) << "," << std::endl
+    << "      \"partition_weights\": " << json_string(
+      toml::find<std::string>(general, "partition_weights")) << ","
+    << std::endl
+    << "      \"dim\": " << mCaseDims.at(index) << "," << std::endl
+    << "      \"num_nodes\": " << json_number(num_nodes) << "," << std::endl
+    << "      \"num_steps\": " << json_number(num_steps) << "," << std::endl
+    << "      \"ode_ns_per_node_step\": "
+    << json_number(best_times[0] * 1e9 / node_steps) << "," << std::endl
+    << "      \"assembly_ns_per_node_step\": "
+    << json_number(best_times[1] * 1e9 / node_steps) << "," << std::endl
+    << "      \"solve_ns_per_node_step\": "
+    << json_number(best_times[2] * 1e9 / node_steps) << "," << std::endl
+    << "      \"output_ns_per_node_print\": "
+    << json_number(best_times[3] * 1e9 / (num_nodes * num_prints)) << ","
+    << std::endl
+    << "      \"cell_creation_ns_per_node\": "
+    << json_number(best_times[4] * 1e9 / num_nodes) << "," << std::endl
+    << "      \"ode_time\": " << json_number(best_times[0]) << "," << std::endl
+    << "      \"ode_imbalance\": " << json_number(ode_imbalance) << ","
+    << std::endl
+    << "      \"assembly_time\": " << json_number(best_times[1]) << ","
+    << std::endl
+    << "      \"solve_time\": " << json_number(best_times[2]) << ","
+    << std::endl
+    << "      \"output_time\": " << json_number(best_times[3]) << ","
+    << std::endl
+    << "      \"cell_creation_time\": " << json_number(best_times[4]) << ","
+    << std::endl
+    << "      \"peak_rss_mb\": " << json_number(peak_rss / (1024 * 1024))
+    << "," << std::endl
+    << "      \"wall_time\": " << json_number(best_times[5]) << std::endl
+    << "    }";
+  return json_stream.str();
+}
+
+
+void UterineBenchmark::Run(std::string output_path) {
+  std::vector<std::string> failed_cases;
+
+  for (unsigned i = 0; i < GetNumCases(); ++i) {
+    std::cout << "Benchmark case " << i + 1 << "/" << GetNumCases() << ": "
+      << mCaseNames[i] << std::endl;
+
+    try {
+      mResults.push_back(RunCase(i));
+    } catch (const Exception& e) {
+      // Carry on with the other cases, the failure is part of the results
+      std::cout << "Benchmark case " << mCaseNames[i] << " failed: "
+        << e.GetShortMessage() << std::endl;
+      failed_cases.push_back(mCaseNames[i]);
+      mResults.push_back("    {\"name\": " + json_string(mCaseNames[i]) +
+                         ", \"status\": \"failed\", \"error\": " +
+                         json_string(e.GetShortMessage()) + "}");
+    }
+  }
+  UterineSharedMesh<2>::Clear();
+  UterineSharedMesh<3>::Clear();
+
+  if (output_path.empty()) {
+    OutputFileHandler handler("benchmark", false);
+    output_path = handler.GetOutputDirectoryFullPath() + "benchmark.json";
+  }
+
+  if (PetscTools::AmMaster()) {
+    // Results are only comparable on the same machine and process count
+    struct utsname machine;
+    uname(&machine);
+
+    std::ofstream output_file(output_path);
+    output_file << "{" << std::endl;
+    output_file << "  \"chaste_version\": "
+      << json_string(ChasteBuildInfo::GetVersionString()) << "," << std::endl;
+    output_file << "  \"project_versions\": "
+      << json_string(ChasteBuildInfo::GetProjectVersions()) << ","
+      << std::endl;
+    output_file << "  \"build_time\": "
+      << json_string(ChasteBuildInfo::GetBuildTime()) << "," << std::endl;
+    output_file << "  \"working_copy_modified\": "
+      << (ChasteBuildInfo::IsWorkingCopyModified() ? "true" : "false") << ","
+      << std::endl;
+    output_file << "  \"host\": " << json_string(machine.nodename) << ","
+      << std::endl;
+    output_file << "  \"num_procs\": " << PetscTools::GetNumProcs() << ","
+      << std::endl;
+    output_file << "  \"sim_duration\": " << json_number(mSimDuration) << ","
+      << std::endl;
+    output_file << "  \"start_time\": " << json_number(mStartTime) << ","
+      << std::endl;
+    output_file << "  \"repeats\": " << mRepeats << "," << std::endl;
+    output_file << "  \"cases\": [";
+
+    for (unsigned i = 0; i < mResults.size(); ++i) {
+      output_file << (i == 0 ? "" : ",") << std::endl << mResults[i];
+    }
+    output_file << std::endl << "  ]" << std::endl << "}" << std::endl;
+    output_file.close();
+  }
+  std::cout << "Benchmark results written to " << output_path << std::endl;
+
+  if (!failed_cases.empty()) {
+    std::string err_msg = "Benchmark cases failed:";
+
+    for (const auto& name : failed_cases) {
+      err_msg += " " + name;
+    }
+
+    const std::string err_filename = "UterineBenchmark.cpp";
+    unsigned line_number = 303;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+}
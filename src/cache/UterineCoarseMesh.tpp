@@ -0,0 +1,305 @@
+#include "../../include/cache/UterineCoarseMesh.hpp"
+
+template <unsigned DIM>
+UterineCoarseMesh<DIM>::UterineCoarseMesh(std::string mesh_path,
+                                          double cluster_size) :
+  mMeshPath(mesh_path), mClusterSize(cluster_size) {
+  mMeshName = mesh_path.substr(mesh_path.find_last_of('/') + 1);
+
+  // Keyed on the state of the source files, as for the binary mesh cache
+  std::ostringstream size_stream;
+  size_stream << std::setprecision(17) << cluster_size;
+  std::uint64_t key = hash_string(size_stream.str(),
+                                  hash_string(mesh_path));
+  const std::vector<std::string> extensions = {".node", ".ele", ".face",
+                                               ".edge", ".ortho"};
+
+  for (const auto& extension : extensions) {
+    key = hash_file_stats(mesh_path + extension, key);
+  }
+
+  mKey = hash_to_string(key);
+  mCacheDir = "mesh_cache/coarse/" + mMeshName + "_" + mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineCoarseMesh<DIM>::GetKey() {
+  return mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineCoarseMesh<DIM>::GetCacheDir() {
+  return mCacheDir;
+}
+
+
+template <unsigned DIM>
+std::string UterineCoarseMesh<DIM>::GetCachedMeshPath() {
+  // The folder is not created, it only appears once complete
+  return OutputFileHandler::GetChasteTestOutputDirectory() + mCacheDir + "/" +
+    mMeshName;
+}
+
+
+template <unsigned DIM>
+bool UterineCoarseMesh<DIM>::IsAvailable(bool orthotropic) {
+  // The info file is written last, a cache without it is incomplete
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+
+  if (!info_file.Exists()) {
+    return false;
+  }
+
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+  return !orthotropic || toml::find<bool>(info, "orthotropic");
+}
+
+
+template <unsigned DIM>
+double UterineCoarseMesh<DIM>::SignedMeasure(
+  const std::vector<std::vector<double>>& rNodes,
+  const std::vector<unsigned>& rIndices) {
+  // Area of a triangle or volume of a tetrahedron, negative if inverted
+  std::vector<std::vector<double>> edges(DIM, std::vector<double>(DIM));
+
+  for (unsigned i = 0; i < DIM; ++i) {
+    for (unsigned d = 0; d < DIM; ++d) {
+      edges[i][d] = rNodes[rIndices[i + 1]][d] - rNodes[rIndices[0]][d];
+    }
+  }
+
+  if (DIM == 2) {
+    return (edges[0][0]*edges[1][1] - edges[0][1]*edges[1][0]) / 2.0;
+  }
+
+  return (edges[0][0]*(edges[1][1]*edges[2][2] - edges[1][2]*edges[2][1]) -
+          edges[0][1]*(edges[1][0]*edges[2][2] - edges[1][2]*edges[2][0]) +
+          edges[0][2]*(edges[1][0]*edges[2][1] - edges[1][1]*edges[2][0])) /
+    6.0;
+}
+
+
+template <unsigned DIM>
+void UterineCoarseMesh<DIM>::Generate(bool orthotropic) {
+  std::cout << "Generating coarse mesh for " << mMeshName
+    << " with a cluster size of " << mClusterSize << std::endl;
+
+  const std::string tmp_dir = make_cache_tmp_dir(mCacheDir);
+  TrianglesMeshWriter<DIM, DIM> mesh_writer(tmp_dir, mMeshName, false);
+  mesh_writer.SetWriteFilesAsBinary();
+  unsigned num_nodes = 0;
+  std::vector<unsigned> kept_elements;  // Source index of the elements
+  std::vector<std::vector<double>> centroids;
+  std::vector<ElementData> elements;
+  bool too_coarse = false;
+
+  if (PetscTools::AmMaster()) {
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+
+    // Merge the nodes within the same cube into their centroid
+    std::map<std::array<long, DIM>, unsigned> cluster_indices;
+    std::vector<unsigned> node_clusters(mesh_reader.GetNumNodes());
+    std::vector<unsigned> cluster_sizes;
+
+    for (unsigned i = 0; i < mesh_reader.GetNumNodes(); ++i) {
+      const std::vector<double> node = mesh_reader.GetNextNode();
+      std::array<long, DIM> cube;
+
+      for (unsigned d = 0; d < DIM; ++d) {
+        cube[d] = static_cast<long>(std::floor(node[d] / mClusterSize));
+      }
+
+      const auto [it, is_new] = cluster_indices.emplace(cube,
+                                                        centroids.size());
+
+      if (is_new) {
+        centroids.push_back(std::vector<double>(DIM, 0.0));
+        cluster_sizes.push_back(0);
+      }
+
+      node_clusters[i] = it->second;
+      ++cluster_sizes[it->second];
+
+      for (unsigned d = 0; d < DIM; ++d) {
+        centroids[it->second][d] += node[d];
+      }
+    }
+
+    for (unsigned i = 0; i < centroids.size(); ++i) {
+      for (unsigned d = 0; d < DIM; ++d) {
+        centroids[i][d] /= cluster_sizes[i];
+      }
+    }
+
+    // Elements whose nodes were merged, or which became flat or duplicated,
+    // are dropped
+    std::set<std::vector<unsigned>> element_keys;
+    const double min_measure = 1e-9 * std::pow(mClusterSize, DIM);
+
+    for (unsigned i = 0; i < mesh_reader.GetNumElements(); ++i) {
+      ElementData element = mesh_reader.GetNextElementData();
+
+      for (auto& node_index : element.NodeIndices) {
+        node_index = node_clusters[node_index];
+      }
+
+      std::vector<unsigned> sorted_indices = element.NodeIndices;
+      std::sort(sorted_indices.begin(), sorted_indices.end());
+
+      if (std::adjacent_find(sorted_indices.begin(), sorted_indices.end()) !=
+          sorted_indices.end() ||
+          !element_keys.insert(sorted_indices).second) {
+        continue;
+      }
+
+      const double measure = SignedMeasure(centroids, element.NodeIndices);
+
+      if (std::fabs(measure) < min_measure) {
+        continue;
+      } else if (measure < 0.0) {
+        // Chaste expects a positive orientation
+        std::swap(element.NodeIndices[0], element.NodeIndices[1]);
+      }
+
+      elements.push_back(element);
+      kept_elements.push_back(i);
+    }
+
+    // The error is raised on all processes below
+    too_coarse = elements.empty();
+  }
+
+  if (PetscTools::ReplicateBool(too_coarse)) {
+    const std::string err_msg = "Cluster size too large to coarsen " +
+      mMeshName;
+    const std::string err_filename = "UterineCoarseMesh.tpp";
+    unsigned line_number = 178;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  if (PetscTools::AmMaster()) {
+    // Number the nodes still used by an element, in the source order
+    std::vector<int> new_indices(centroids.size(), -1);
+
+    for (const auto& element : elements) {
+      for (const auto node_index : element.NodeIndices) {
+        new_indices[node_index] = 0;
+      }
+    }
+
+    for (unsigned i = 0; i < centroids.size(); ++i) {
+      if (new_indices[i] == 0) {
+        new_indices[i] = num_nodes++;
+        mesh_writer.SetNextNode(centroids[i]);
+      }
+    }
+
+    // The boundary is made of the faces that belong to a single element
+    std::map<std::vector<unsigned>, std::vector<unsigned>> faces;
+    std::map<std::vector<unsigned>, unsigned> face_counts;
+
+    for (auto& element : elements) {
+      for (auto& node_index : element.NodeIndices) {
+        node_index = new_indices[node_index];
+      }
+      mesh_writer.SetNextElement(element);
+
+      for (unsigned i = 0; i <= DIM; ++i) {
+        std::vector<unsigned> face;
+
+        for (unsigned j = 0; j <= DIM; ++j) {
+          if (j != i) {
+            face.push_back(element.NodeIndices[j]);
+          }
+        }
+
+        std::vector<unsigned> sorted_face = face;
+        std::sort(sorted_face.begin(), sorted_face.end());
+        faces[sorted_face] = face;
+        ++face_counts[sorted_face];
+      }
+    }
+
+    for (const auto& [sorted_face, face] : faces) {
+      if (face_counts[sorted_face] == 1) {
+        ElementData face_data;
+        face_data.NodeIndices = face;
+        face_data.AttributeValue = 0.0;
+        face_data.ContainingElement = 0;
+        mesh_writer.SetNextBoundaryFace(face_data);
+      }
+    }
+
+    mesh_writer.WriteFiles();
+    std::cout << "  coarsened to " << num_nodes << " nodes and "
+      << elements.size() << " elements" << std::endl;
+  }
+
+  if (orthotropic) {
+    // Fibres are given per element, keep those of the remaining elements
+    FibreWriter<DIM> fibre_writer(tmp_dir, mMeshName, false);
+    fibre_writer.SetWriteFileAsBinary();
+
+    if (PetscTools::AmMaster()) {
+      FibreReader<DIM> fibre_reader(
+        FileFinder(mMeshPath + ".ortho", RelativeTo::AbsoluteOrCwd),
+        ORTHO);
+      std::vector<c_vector<double, DIM>> fibres;
+      std::vector<c_vector<double, DIM>> sheets;
+      std::vector<c_vector<double, DIM>> normals;
+      std::vector<c_vector<double, DIM>> kept_fibres;
+      std::vector<c_vector<double, DIM>> kept_sheets;
+      std::vector<c_vector<double, DIM>> kept_normals;
+
+      fibre_reader.GetAllOrtho(fibres, sheets, normals);
+
+      for (const auto element_index : kept_elements) {
+        kept_fibres.push_back(fibres[element_index]);
+        kept_sheets.push_back(sheets[element_index]);
+        kept_normals.push_back(normals[element_index]);
+      }
+      fibre_writer.WriteAllOrthoFibres(kept_fibres, kept_sheets,
+                                       kept_normals);
+    }
+  }
+
+  // Mark the cache as complete once all the files are written
+  PetscTools::Barrier("UterineCoarseMesh::Generate");
+  OutputFileHandler handler(tmp_dir, false);
+
+  if (PetscTools::AmMaster()) {
+    out_stream info_file = handler.OpenOutputFile("info.toml");
+    *info_file << "source = \"" << mMeshPath << "\"" << std::endl;
+    *info_file << "cluster_size = " << std::setprecision(17) << mClusterSize
+      << std::endl;
+    *info_file << "orthotropic = " << (orthotropic ? "true" : "false")
+      << std::endl;
+    *info_file << "num_nodes = " << num_nodes << std::endl;
+    *info_file << "num_elements = " << kept_elements.size() << std::endl;
+    info_file->close();
+  }
+  // A cache without the fibres is replaced by the one with them
+  publish_cache_dir(tmp_dir, mCacheDir, orthotropic);
+}
+
+
+template <unsigned DIM>
+std::string UterineCoarseMesh<DIM>::GetMeshPath(bool orthotropic) {
+  if (IsAvailable(orthotropic)) {
+    std::cout << "Loading cached coarse mesh " << mCacheDir << std::endl;
+  } else {
+    Generate(orthotropic);
+
+    // Another run may have published a cache without the fibres meanwhile
+    if (!IsAvailable(orthotropic)) {
+      const std::string err_msg = "Cached coarse mesh " + mCacheDir +
+        " could not be published";
+      const std::string err_filename = "UterineCoarseMesh.tpp";
+      unsigned line_number = 300;
+      throw Exception(err_msg, err_filename, line_number);
+    }
+  }
+  return GetCachedMeshPath();
+}
@@ -0,0 +1,118 @@
+#include "../../include/cache/UterineMeshCache.hpp"
+
+template <unsigned DIM>
+UterineMeshCache<DIM>::UterineMeshCache(std::string mesh_path) :
+  mMeshPath(mesh_path) {
+  mMeshName = mesh_path.substr(mesh_path.find_last_of('/') + 1);
+
+  // Key the cache on the state of the source files rather than their
+  // content so that checking the cache is cheaper than reading the mesh
+  std::uint64_t key = hash_string(mesh_path);
+  const std::vector<std::string> extensions = {".node", ".ele", ".face",
+                                               ".edge", ".ortho"};
+
+  for (const auto& extension : extensions) {
+    key = hash_file_stats(mesh_path + extension, key);
+  }
+
+  mKey = hash_to_string(key);
+  mCacheDir = "mesh_cache/" + mMeshName + "_" + mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshCache<DIM>::GetKey() {
+  return mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshCache<DIM>::GetCacheDir() {
+  return mCacheDir;
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshCache<DIM>::GetCachedMeshPath() {
+  // The folder is not created, it only appears once complete
+  return OutputFileHandler::GetChasteTestOutputDirectory() + mCacheDir + "/" +
+    mMeshName;
+}
+
+
+template <unsigned DIM>
+bool UterineMeshCache<DIM>::IsAvailable(bool orthotropic) {
+  // The info file is written last, a cache without it is incomplete
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+
+  if (!info_file.Exists()) {
+    return false;
+  }
+
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+  return !orthotropic || toml::find<bool>(info, "orthotropic");
+}
+
+
+template <unsigned DIM>
+void UterineMeshCache<DIM>::Generate(bool orthotropic) {
+  std::cout << "Generating binary mesh cache for " << mMeshName << std::endl;
+
+  // Write the nodes, elements and boundary elements in binary
+  const std::string tmp_dir = make_cache_tmp_dir(mCacheDir);
+  TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+  TrianglesMeshWriter<DIM, DIM> mesh_writer(tmp_dir, mMeshName, false);
+  mesh_writer.SetWriteFilesAsBinary();
+  mesh_writer.WriteFilesUsingMeshReader(mesh_reader);
+
+  if (orthotropic) {
+    FibreWriter<DIM> fibre_writer(tmp_dir, mMeshName, false);
+    fibre_writer.SetWriteFileAsBinary();
+
+    if (PetscTools::AmMaster()) {
+      FibreReader<DIM> fibre_reader(
+        FileFinder(mMeshPath + ".ortho", RelativeTo::AbsoluteOrCwd),
+        ORTHO);
+      std::vector<c_vector<double, DIM>> fibres;
+      std::vector<c_vector<double, DIM>> sheets;
+      std::vector<c_vector<double, DIM>> normals;
+
+      fibre_reader.GetAllOrtho(fibres, sheets, normals);
+      fibre_writer.WriteAllOrthoFibres(fibres, sheets, normals);
+    }
+  }
+
+  // Mark the cache as complete once all the files are written
+  PetscTools::Barrier("UterineMeshCache::Generate");
+  OutputFileHandler handler(tmp_dir, false);
+
+  if (PetscTools::AmMaster()) {
+    out_stream info_file = handler.OpenOutputFile("info.toml");
+    *info_file << "source = \"" << mMeshPath << "\"" << std::endl;
+    *info_file << "orthotropic = " << (orthotropic ? "true" : "false")
+      << std::endl;
+    info_file->close();
+  }
+  // A cache without the fibres is replaced by the one with them
+  publish_cache_dir(tmp_dir, mCacheDir, orthotropic);
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshCache<DIM>::GetMeshPath(bool orthotropic) {
+  if (IsAvailable(orthotropic)) {
+    std::cout << "Loading cached binary mesh " << mCacheDir << std::endl;
+  } else {
+    Generate(orthotropic);
+
+    // Another run may have published a cache without the fibres meanwhile
+    if (!IsAvailable(orthotropic)) {
+      const std::string err_msg = "Cached binary mesh " + mCacheDir +
+        " could not be published";
+      const std::string err_filename = "UterineMeshCache.tpp";
+      unsigned line_number = 113;
+      throw Exception(err_msg, err_filename, line_number);
+    }
+  }
+  return GetCachedMeshPath();
+}
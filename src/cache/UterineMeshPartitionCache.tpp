@@ -0,0 +1,380 @@
+#include "../../include/cache/UterineMeshPartitionCache.hpp"
+
+template <unsigned DIM>
+UterineMeshPartitionCache<DIM>::UterineMeshPartitionCache(
+  std::string mesh_path, std::string weights_key) :
+  mMeshPath(mesh_path), mWeighted(!weights_key.empty()) {
+  mMeshName = mesh_path.substr(mesh_path.find_last_of('/') + 1);
+
+  if (mWeighted) {
+    // METIS on the node graph, whatever the partitioning method
+    mPartitioner = "weighted";
+  } else {
+    switch (HeartConfig::Instance()->GetMeshPartitioning()) {
+      case DistributedTetrahedralMeshPartitionType::DUMB:
+        mPartitioner = "dumb";
+        break;
+      case DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY:
+        mPartitioner = "parmetis";
+        break;
+      case DistributedTetrahedralMeshPartitionType::PETSC_MAT_PARTITION:
+        mPartitioner = "petsc";
+        break;
+      default:
+        mPartitioner = std::to_string(
+          static_cast<int>(HeartConfig::Instance()->GetMeshPartitioning()));
+    }
+  }
+
+  // The partition only depends on the mesh, the number of processes and
+  // the partitioning method
+  std::uint64_t key = hash_string(mesh_path);
+  const std::vector<std::string> extensions = {".node", ".ele", ".face",
+                                               ".edge", ".ortho"};
+
+  for (const auto& extension : extensions) {
+    key = hash_file_stats(mesh_path + extension, key);
+  }
+
+  key = hash_combine(key, PetscTools::GetNumProcs());
+  key = hash_string(mPartitioner, key);
+  key = hash_string(weights_key, key);
+
+  std::stringstream cache_dir;
+  cache_dir << "mesh_cache/partitions/" << mMeshName << "_"
+    << PetscTools::GetNumProcs() << "_" << mPartitioner << "_"
+    << hash_to_string(key);
+
+  mKey = hash_to_string(key);
+  mCacheDir = cache_dir.str();
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshPartitionCache<DIM>::GetKey() {
+  return mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshPartitionCache<DIM>::GetCacheDir() {
+  return mCacheDir;
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshPartitionCache<DIM>::GetCachedMeshPath() {
+  // The folder is not created, it only appears once complete
+  return OutputFileHandler::GetChasteTestOutputDirectory() + mCacheDir + "/" +
+    mMeshName;
+}
+
+
+template <unsigned DIM>
+std::vector<unsigned> UterineMeshPartitionCache<DIM>::ReadPermutation() {
+  // Index in the cached mesh of each node of the source mesh, empty if the
+  // nodes kept their order
+  FileFinder permutation_file(mCacheDir + "/permutation.bin",
+                              RelativeTo::ChasteTestOutput);
+  std::ifstream permutation_stream(permutation_file.GetAbsolutePath(),
+                                   std::ios::binary | std::ios::ate);
+  std::vector<unsigned> permutation(permutation_stream.tellg() /
+                                    sizeof(unsigned));
+  permutation_stream.seekg(0);
+  permutation_stream.read(reinterpret_cast<char*>(permutation.data()),
+                          permutation.size() * sizeof(unsigned));
+  return permutation;
+}
+
+
+template <unsigned DIM>
+bool UterineMeshPartitionCache<DIM>::IsAvailable(bool orthotropic) {
+  // The info file is written last, a cache without it is incomplete
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+
+  if (!info_file.Exists()) {
+    return false;
+  }
+
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+  return !orthotropic || toml::find<bool>(info, "orthotropic");
+}
+
+
+template <unsigned DIM>
+void UterineMeshPartitionCache<DIM>::SetNodeWeights(
+  const std::vector<double>& rNodeWeights) {
+  mNodeWeights = rNodeWeights;
+}
+
+
+template <unsigned DIM>
+void UterineMeshPartitionCache<DIM>::Partition(
+  std::vector<unsigned>& rPermutation, std::vector<unsigned>& rLocalSizes) {
+  // Let Chaste partition the mesh once with the configured method
+  TrianglesMeshReader<DIM, DIM> partition_reader(mMeshPath);
+  DistributedTetrahedralMesh<DIM, DIM> mesh(
+    HeartConfig::Instance()->GetMeshPartitioning());
+  mesh.ConstructFromMeshReader(partition_reader);
+
+  rPermutation = mesh.rGetNodePermutation();
+  unsigned local_size =
+    mesh.GetDistributedVectorFactory()->GetLocalOwnership();
+  rLocalSizes.resize(PetscTools::GetNumProcs());
+
+  MPI_Allgather(&local_size, 1, MPI_UNSIGNED, rLocalSizes.data(), 1,
+                MPI_UNSIGNED, PETSC_COMM_WORLD);
+}
+
+
+template <unsigned DIM>
+void UterineMeshPartitionCache<DIM>::PartitionWeighted(
+  std::vector<unsigned>& rPermutation, std::vector<unsigned>& rLocalSizes) {
+  // Partition the node graph with METIS so that each process gets the same
+  // total weight rather than the same number of nodes
+  const unsigned num_procs = PetscTools::GetNumProcs();
+  rLocalSizes.assign(num_procs, 0);
+  bool valid = true;
+
+  if (PetscTools::AmMaster()) {
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+    const unsigned num_nodes = mesh_reader.GetNumNodes();
+    std::vector<std::vector<idx_t>> neighbours(num_nodes);
+
+    for (unsigned i = 0; i < mesh_reader.GetNumElements(); ++i) {
+      const std::vector<unsigned> node_indices =
+        mesh_reader.GetNextElementData().NodeIndices;
+
+      for (const auto node_index : node_indices) {
+        for (const auto neighbour_index : node_indices) {
+          if (neighbour_index != node_index) {
+            neighbours[node_index].push_back(neighbour_index);
+          }
+        }
+      }
+    }
+
+    // Compressed adjacency, and integer weights relative to the largest one
+    std::vector<idx_t> adjacency_starts(1, 0);
+    std::vector<idx_t> adjacency;
+    std::vector<idx_t> weights(num_nodes);
+    mNodeWeights.resize(num_nodes, 0.0);  // Weights of another mesh fail
+    const double max_weight = *std::max_element(mNodeWeights.begin(),
+                                                mNodeWeights.end());
+
+    for (unsigned i = 0; i < num_nodes; ++i) {
+      std::sort(neighbours[i].begin(), neighbours[i].end());
+      neighbours[i].erase(std::unique(neighbours[i].begin(),
+                                      neighbours[i].end()),
+                          neighbours[i].end());
+      adjacency.insert(adjacency.end(), neighbours[i].begin(),
+                       neighbours[i].end());
+      adjacency_starts.push_back(adjacency.size());
+      std::vector<idx_t>().swap(neighbours[i]);
+
+      weights[i] = std::max<idx_t>(1, std::lround(
+        1000.0 * mNodeWeights[i] / max_weight));
+    }
+
+    std::vector<idx_t> parts(num_nodes, 0);
+
+    if (num_procs > 1) {
+      idx_t num_vertices = num_nodes;
+      idx_t num_constraints = 1;
+      idx_t num_parts = num_procs;
+      idx_t edge_cut;
+      idx_t options[METIS_NOPTIONS];
+      METIS_SetDefaultOptions(options);
+
+      valid = METIS_PartGraphKway(
+        &num_vertices, &num_constraints, adjacency_starts.data(),
+        adjacency.data(), weights.data(), NULL, NULL, &num_parts, NULL, NULL,
+        options, &edge_cut, parts.data()) == METIS_OK;
+    }
+
+    // Nodes of each process are numbered contiguously, in the source order
+    for (const auto part : parts) {
+      ++rLocalSizes[part];
+    }
+
+    std::vector<unsigned> offsets(num_procs, 0);
+
+    for (unsigned i = 1; i < num_procs; ++i) {
+      offsets[i] = offsets[i - 1] + rLocalSizes[i - 1];
+    }
+
+    rPermutation.resize(num_nodes);
+
+    for (unsigned i = 0; i < num_nodes; ++i) {
+      rPermutation[i] = offsets[parts[i]]++;
+    }
+
+    valid = valid && std::find(rLocalSizes.begin(), rLocalSizes.end(), 0u) ==
+      rLocalSizes.end();
+  }
+
+  if (PetscTools::ReplicateBool(!valid)) {
+    const std::string err_msg = "Weighted partitioning of " + mMeshName +
+      " failed or left a process without nodes";
+    const std::string err_filename = "UterineMeshPartitionCache.tpp";
+    unsigned line_number = 223;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+  MPI_Bcast(rLocalSizes.data(), num_procs, MPI_UNSIGNED, 0, PETSC_COMM_WORLD);
+}
+
+
+template <unsigned DIM>
+void UterineMeshPartitionCache<DIM>::Generate(bool orthotropic) {
+  std::cout << "Partitioning " << mMeshName << " for "
+    << PetscTools::GetNumProcs() << " processes"
+    << (mWeighted ? " with node weights" : "") << std::endl;
+
+  // The permutation is only needed on the master process, which writes
+  std::vector<unsigned> permutation;
+  std::vector<unsigned> local_sizes;
+
+  if (mWeighted) {
+    PartitionWeighted(permutation, local_sizes);
+  } else {
+    Partition(permutation, local_sizes);
+  }
+
+  // Write the nodes in the partitioned order so that each process owns a
+  // contiguous block of nodes when the mesh is read back
+  const std::string tmp_dir = make_cache_tmp_dir(mCacheDir);
+  TrianglesMeshWriter<DIM, DIM> mesh_writer(tmp_dir, mMeshName, false);
+  mesh_writer.SetWriteFilesAsBinary();
+
+  if (PetscTools::AmMaster()) {
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+    std::vector<std::vector<double>> nodes(mesh_reader.GetNumNodes());
+
+    for (unsigned i = 0; i < mesh_reader.GetNumNodes(); ++i) {
+      unsigned index = permutation.empty() ? i : permutation[i];
+      nodes[index] = mesh_reader.GetNextNode();
+    }
+
+    for (const auto& node : nodes) {
+      mesh_writer.SetNextNode(node);
+    }
+
+    // Elements keep their order, only their node indices change
+    for (unsigned i = 0; i < mesh_reader.GetNumElements(); ++i) {
+      ElementData element = mesh_reader.GetNextElementData();
+
+      for (auto& node_index : element.NodeIndices) {
+        node_index = permutation.empty() ? node_index :
+          permutation[node_index];
+      }
+      mesh_writer.SetNextElement(element);
+    }
+
+    for (unsigned i = 0; i < mesh_reader.GetNumFaces(); ++i) {
+      ElementData face = mesh_reader.GetNextFaceData();
+
+      for (auto& node_index : face.NodeIndices) {
+        node_index = permutation.empty() ? node_index :
+          permutation[node_index];
+      }
+      mesh_writer.SetNextBoundaryFace(face);
+    }
+
+    mesh_writer.WriteFiles();
+  }
+
+  if (orthotropic) {
+    // Fibres are given per element and do not need to be permuted
+    FibreWriter<DIM> fibre_writer(tmp_dir, mMeshName, false);
+    fibre_writer.SetWriteFileAsBinary();
+
+    if (PetscTools::AmMaster()) {
+      FibreReader<DIM> fibre_reader(
+        FileFinder(mMeshPath + ".ortho", RelativeTo::AbsoluteOrCwd),
+        ORTHO);
+      std::vector<c_vector<double, DIM>> fibres;
+      std::vector<c_vector<double, DIM>> sheets;
+      std::vector<c_vector<double, DIM>> normals;
+
+      fibre_reader.GetAllOrtho(fibres, sheets, normals);
+      fibre_writer.WriteAllOrthoFibres(fibres, sheets, normals);
+    }
+  }
+
+  // Mark the cache as complete once all the files are written
+  PetscTools::Barrier("UterineMeshPartitionCache::Generate");
+  OutputFileHandler handler(tmp_dir, false);
+
+  if (PetscTools::AmMaster()) {
+    // Outputs are written in the source order through the permutation
+    out_stream permutation_file = handler.OpenOutputFile(
+      "permutation.bin", std::ios::out | std::ios::binary);
+    permutation_file->write(reinterpret_cast<const char*>(permutation.data()),
+                            permutation.size() * sizeof(unsigned));
+    permutation_file->close();
+
+    out_stream info_file = handler.OpenOutputFile("info.toml");
+    *info_file << "source = \"" << mMeshPath << "\"" << std::endl;
+    *info_file << "partitioner = \"" << mPartitioner << "\"" << std::endl;
+    *info_file << "orthotropic = " << (orthotropic ? "true" : "false")
+      << std::endl;
+    *info_file << "local_sizes = [";
+
+    for (unsigned i = 0; i < local_sizes.size(); ++i) {
+      *info_file << (i == 0 ? "" : ", ") << local_sizes[i];
+    }
+    *info_file << "]" << std::endl;
+    info_file->close();
+  }
+  // A cache without the fibres is replaced by the one with them
+  publish_cache_dir(tmp_dir, mCacheDir, orthotropic);
+}
+
+
+template <unsigned DIM>
+std::string UterineMeshPartitionCache<DIM>::GetMeshPath(bool orthotropic) {
+  if (IsAvailable(orthotropic)) {
+    std::cout << "Loading cached mesh partition " << mCacheDir << std::endl;
+  } else {
+    Generate(orthotropic);
+
+    // Another run may have published a cache without the fibres meanwhile
+    if (!IsAvailable(orthotropic)) {
+      const std::string err_msg = "Cached mesh partition " + mCacheDir +
+        " could not be published";
+      const std::string err_filename = "UterineMeshPartitionCache.tpp";
+      unsigned line_number = 349;
+      throw Exception(err_msg, err_filename, line_number);
+    }
+  }
+  return GetCachedMeshPath();
+}
+
+
+template <unsigned DIM>
+void UterineMeshPartitionCache<DIM>::ConstructMesh(
+  DistributedTetrahedralMesh<DIM, DIM>& rMesh) {
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+  const std::vector<unsigned> local_sizes = toml::find<std::vector<unsigned>>(
+    info, "local_sizes");
+
+  if (local_sizes.size() != PetscTools::GetNumProcs()) {
+    const std::string err_msg = "Mesh partition was cached for another "
+      "number of processes";
+    const std::string err_filename = "UterineMeshPartitionCache.tpp";
+    unsigned line_number = 369;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  // Giving the ownership ranges to the mesh bypasses the partitioning, the
+  // mesh takes ownership of the factory
+  TrianglesMeshReader<DIM, DIM> mesh_reader(GetCachedMeshPath());
+  rMesh.SetDistributedVectorFactory(new DistributedVectorFactory(
+    mesh_reader.GetNumNodes(), local_sizes[PetscTools::GetMyRank()]));
+  rMesh.ConstructFromMeshReader(mesh_reader);
+
+  // The mesh then maps the source nodes as if Chaste had partitioned it, so
+  // that the outputs keep the node order of the source mesh
+  PermutationAccess::rGet(rMesh) = ReadPermutation();
+}
@@ -0,0 +1,116 @@
+#include "../../include/cache/UterinePartitionWeights.hpp"
+
+template <unsigned DIM>
+UterinePartitionWeights<DIM>::UterinePartitionWeights(std::string mesh_path) :
+  mMeshPath(mesh_path) {
+}
+
+
+template <unsigned DIM>
+void UterinePartitionWeights<DIM>::SetKey() {
+  // Hash the values rather than their source so that the partition is only
+  // generated again when the weights change
+  std::uint64_t key = 0;
+
+  if (PetscTools::AmMaster()) {
+    key = hash_string(std::string(
+      reinterpret_cast<const char*>(mWeights.data()),
+      mWeights.size()*sizeof(double)));
+  }
+  MPI_Bcast(&key, 1, MPI_UINT64_T, 0, PETSC_COMM_WORLD);
+  mKey = hash_to_string(key);
+}
+
+
+template <unsigned DIM>
+void UterinePartitionWeights<DIM>::ReadCostMap(std::string cost_map_path) {
+  // ODE time of each node, as written with cell_profiling
+  bool complete = true;
+
+  if (PetscTools::AmMaster()) {
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+    mWeights.assign(mesh_reader.GetNumNodes(), 0.0);
+    std::vector<bool> has_cost(mWeights.size(), false);
+    std::ifstream cost_file(cost_map_path);
+    std::string line;
+    std::getline(cost_file, line);  // Header
+
+    while (std::getline(cost_file, line)) {
+      std::istringstream line_stream(line);
+      unsigned node;
+      char separator;
+      double ode_time;
+
+      if (!(line_stream >> node >> separator >> ode_time) ||
+          node >= mWeights.size()) {
+        complete = false;
+        break;
+      }
+      mWeights[node] = ode_time;
+      has_cost[node] = true;
+    }
+
+    // A map of another mesh, or of a run without profiled cells
+    complete = complete &&
+      std::find(has_cost.begin(), has_cost.end(), false) == has_cost.end() &&
+      std::find_if(mWeights.begin(), mWeights.end(),
+                   [](double weight) { return weight > 0.0; }) !=
+      mWeights.end();
+  }
+
+  if (PetscTools::ReplicateBool(!complete)) {
+    const std::string err_msg = "Cost map " + cost_map_path +
+      " does not give the cost of every node of " + mMeshPath;
+    const std::string err_filename = "UterinePartitionWeights.tpp";
+    unsigned line_number = 65;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+  SetKey();
+}
+
+
+template <unsigned DIM>
+void UterinePartitionWeights<DIM>::SetRegionCosts(
+  AbstractUterineCellFactoryTemplate<DIM>* pFactory,
+  const std::vector<double>& rRegionCosts) {
+  // Relative cost of the nodes outside of the stimulus and in each of its
+  // regions
+  bool valid = true;
+
+  if (PetscTools::AmMaster()) {
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mMeshPath);
+    mWeights.resize(mesh_reader.GetNumNodes());
+
+    for (unsigned i = 0; i < mesh_reader.GetNumNodes(); ++i) {
+      const unsigned region = pFactory->GetStimulusRegion(
+        mesh_reader.GetNextNode());
+
+      if (region >= rRegionCosts.size() || rRegionCosts[region] <= 0.0) {
+        valid = false;
+        break;
+      }
+      mWeights[i] = rRegionCosts[region];
+    }
+  }
+
+  if (PetscTools::ReplicateBool(!valid)) {
+    const std::string err_msg = "region_costs needs a positive cost for "
+      "each stimulus region of " + mMeshPath;
+    const std::string err_filename = "UterinePartitionWeights.tpp";
+    unsigned line_number = 100;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+  SetKey();
+}
+
+
+template <unsigned DIM>
+const std::vector<double>& UterinePartitionWeights<DIM>::rGetWeights() {
+  return mWeights;
+}
+
+
+template <unsigned DIM>
+std::string UterinePartitionWeights<DIM>::GetKey() {
+  return mKey;
+}
@@ -0,0 +1,96 @@
+#include "../../include/cache/UterineResultCache.hpp"
+
+UterineResultCache::UterineResultCache(std::string key) :
+  mKey(key), mCacheDir("result_cache/" + key) {
+}
+
+
+std::string UterineResultCache::GetKey() {
+  return mKey;
+}
+
+
+std::string UterineResultCache::GetCacheDir() {
+  return mCacheDir;
+}
+
+
+bool UterineResultCache::IsAvailable() {
+  // The folder only appears under the key once complete, the marker is
+  // checked as well in case it was copied by hand
+  bool available = false;
+
+  if (PetscTools::AmMaster()) {
+    FileFinder marker(mCacheDir + "/.complete", RelativeTo::ChasteTestOutput);
+    available = marker.Exists();
+  }
+  return PetscTools::ReplicateBool(available);
+}
+
+
+void UterineResultCache::LinkTree(const std::filesystem::path& source,
+                                  const std::filesystem::path& destination) {
+  std::filesystem::create_directories(destination);
+
+  for (const auto& entry :
+       std::filesystem::recursive_directory_iterator(source)) {
+    if (entry.path().filename() == ".complete") {
+      continue;
+    }
+
+    const std::filesystem::path target = destination /
+      std::filesystem::relative(entry.path(), source);
+
+    if (entry.is_directory()) {
+      std::filesystem::create_directories(target);
+      continue;
+    }
+
+    // Hard links do not use any space, copy if the folders are on
+    // different file systems
+    std::error_code error;
+    std::filesystem::remove(target, error);
+    std::filesystem::create_hard_link(entry.path(), target, error);
+
+    if (error) {
+      std::filesystem::copy_file(entry.path(), target);
+    }
+  }
+}
+
+
+void UterineResultCache::Store(const std::string& output_dir) {
+  if (PetscTools::AmMaster()) {
+    const std::string root = OutputFileHandler::GetChasteTestOutputDirectory();
+    const std::filesystem::path cache_path(root + mCacheDir);
+    std::filesystem::path tmp_path(cache_path);
+    tmp_path += ".tmp_" + get_process_tag();
+
+    // Fill a private folder and move it under the key once complete, so
+    // that interrupted runs are never taken for results
+    std::filesystem::remove_all(tmp_path);
+    LinkTree(root + output_dir, tmp_path);
+
+    std::ofstream marker_file(tmp_path / ".complete");
+    marker_file << mKey << std::endl;
+    marker_file.close();
+
+    std::error_code error;
+    std::filesystem::rename(tmp_path, cache_path, error);
+
+    if (error) {
+      // Another run with the same key finished first
+      std::filesystem::remove_all(tmp_path);
+    }
+  }
+  PetscTools::Barrier("UterineResultCache::Store");
+}
+
+
+void UterineResultCache::Restore(const std::string& output_dir) {
+  if (PetscTools::AmMaster()) {
+    const std::string root = OutputFileHandler::GetChasteTestOutputDirectory();
+    LinkTree(root + mCacheDir, root + output_dir);
+  }
+  PetscTools::Barrier("UterineResultCache::Restore");
+}
@@ -0,0 +1,47 @@
+#include "../../include/cache/UterineSharedMesh.hpp"
+
+template <unsigned DIM>
+DistributedTetrahedralMesh<DIM, DIM>* UterineSharedMesh<DIM>::mpMesh = NULL;
+
+template <unsigned DIM>
+std::string UterineSharedMesh<DIM>::mMeshPath = "";
+
+
+template <unsigned DIM>
+DistributedTetrahedralMesh<DIM, DIM>* UterineSharedMesh<DIM>::Get(
+  std::string mesh_path, std::string partition_source,
+  std::string partition_weights_key) {
+  if (mpMesh != NULL && mMeshPath == mesh_path) {
+    std::cout << "Reusing mesh " << mesh_path << std::endl;
+    return mpMesh;
+  }
+
+  Clear();
+  HeartEventHandler::BeginEvent(HeartEventHandler::READ_MESH);
+
+  if (!partition_source.empty()) {
+    // The cached partition is already in the node order of the processes
+    mpMesh = new DistributedTetrahedralMesh<DIM, DIM>(
+      DistributedTetrahedralMeshPartitionType::DUMB);
+    UterineMeshPartitionCache<DIM> cache(partition_source,
+                                         partition_weights_key);
+    cache.ConstructMesh(*mpMesh);
+  } else {
+    mpMesh = new DistributedTetrahedralMesh<DIM, DIM>(
+      HeartConfig::Instance()->GetMeshPartitioning());
+    TrianglesMeshReader<DIM, DIM> mesh_reader(mesh_path);
+    mpMesh->ConstructFromMeshReader(mesh_reader);
+  }
+
+  HeartEventHandler::EndEvent(HeartEventHandler::READ_MESH);
+  mMeshPath = mesh_path;
+  return mpMesh;
+}
+
+
+template <unsigned DIM>
+void UterineSharedMesh<DIM>::Clear() {
+  delete mpMesh;
+  mpMesh = NULL;
+  mMeshPath = "";
+}
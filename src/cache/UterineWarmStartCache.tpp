@@ -0,0 +1,149 @@
+#include "../../include/cache/UterineWarmStartCache.hpp"
+
+template <unsigned DIM>
+UterineWarmStartCache<DIM>::UterineWarmStartCache(std::string key) :
+  mKey(key), mCacheDir("warm_start/" + key) {
+}
+
+
+template <unsigned DIM>
+std::string UterineWarmStartCache<DIM>::GetKey() {
+  return mKey;
+}
+
+
+template <unsigned DIM>
+std::string UterineWarmStartCache<DIM>::GetCacheDir() {
+  return mCacheDir;
+}
+
+
+template <unsigned DIM>
+bool UterineWarmStartCache<DIM>::IsAvailable() {
+  // The info file is written last, a cache without it is incomplete
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+  return info_file.Exists();
+}
+
+
+template <unsigned DIM>
+double UterineWarmStartCache<DIM>::GetTime() {
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+
+  return toml::find<double>(info, "time");
+}
+
+
+template <unsigned DIM>
+void UterineWarmStartCache<DIM>::Save(MonodomainProblem<DIM>& problem) {
+  const std::string tmp_dir = make_cache_tmp_dir(mCacheDir);
+  OutputFileHandler handler(tmp_dir, false);
+  AbstractTetrahedralMesh<DIM, DIM>& r_mesh = problem.rGetMesh();
+  DistributedVectorFactory* p_vector_factory =
+    r_mesh.GetDistributedVectorFactory();
+
+  // Save the states with the node index of the mesh file so that the cache
+  // does not depend on the partitioning or the number of processes
+  const std::vector<unsigned>& r_permutation = r_mesh.rGetNodePermutation();
+  std::vector<unsigned> original_index(r_permutation.size());
+
+  for (unsigned i = 0; i < r_permutation.size(); ++i) {
+    original_index[r_permutation[i]] = i;
+  }
+
+  std::stringstream state_file_name;
+  state_file_name << "state_" << PetscTools::GetMyRank() << ".bin";
+  out_stream state_file = handler.OpenOutputFile(state_file_name.str(),
+                                                 std::ios::out | std::ios::binary);
+
+  for (unsigned index = p_vector_factory->GetLow();
+       index < p_vector_factory->GetHigh();
+       ++index) {
+    AbstractCardiacCellInterface* p_cell =
+      problem.GetTissue()->GetCardiacCell(index);
+    AbstractUterineCompactCell::ExpandCellState(p_cell);
+    std::vector<double> states = p_cell->GetStdVecStateVariables();
+    unsigned node_index = r_permutation.empty() ? index : original_index[index];
+    unsigned nb_states = states.size();
+
+    state_file->write(reinterpret_cast<const char*>(&node_index),
+                      sizeof(unsigned));
+    state_file->write(reinterpret_cast<const char*>(&nb_states),
+                      sizeof(unsigned));
+    state_file->write(reinterpret_cast<const char*>(states.data()),
+                      nb_states*sizeof(double));
+  }
+  state_file->close();
+
+  // Mark the cache as complete once every process has written its states
+  PetscTools::Barrier("UterineWarmStartCache::Save");
+
+  if (PetscTools::AmMaster()) {
+    out_stream info_file = handler.OpenOutputFile("info.toml");
+    *info_file << std::setprecision(17);
+    *info_file << "num_files = " << PetscTools::GetNumProcs() << std::endl;
+    *info_file << "time = " << problem.GetCurrentTime() << std::endl;
+    info_file->close();
+  }
+  publish_cache_dir(tmp_dir, mCacheDir);
+}
+
+
+template <unsigned DIM>
+void UterineWarmStartCache<DIM>::Load(MonodomainProblem<DIM>& problem) {
+  FileFinder info_file(mCacheDir + "/info.toml", RelativeTo::ChasteTestOutput);
+  const auto info = toml::parse(info_file.GetAbsolutePath());
+  const unsigned num_files = toml::find<unsigned>(info, "num_files");
+
+  AbstractTetrahedralMesh<DIM, DIM>& r_mesh = problem.rGetMesh();
+  DistributedVectorFactory* p_vector_factory =
+    r_mesh.GetDistributedVectorFactory();
+  const std::vector<unsigned>& r_permutation = r_mesh.rGetNodePermutation();
+
+  for (unsigned i = 0; i < num_files; ++i) {
+    std::stringstream state_file_name;
+    state_file_name << mCacheDir << "/state_" << i << ".bin";
+    FileFinder state_finder(state_file_name.str(),
+                            RelativeTo::ChasteTestOutput);
+    std::ifstream state_file(state_finder.GetAbsolutePath(), std::ios::binary);
+
+    unsigned node_index;
+    unsigned nb_states;
+
+    while (state_file.read(reinterpret_cast<char*>(&node_index),
+                           sizeof(unsigned))) {
+      state_file.read(reinterpret_cast<char*>(&nb_states), sizeof(unsigned));
+      std::vector<double> states(nb_states);
+      state_file.read(reinterpret_cast<char*>(states.data()),
+                      nb_states*sizeof(double));
+
+      unsigned index = r_permutation.empty() ? node_index :
+        r_permutation[node_index];
+
+      if (!p_vector_factory->IsGlobalIndexLocal(index)) {
+        continue;  // Node is owned by another process
+      }
+
+      AbstractCardiacCellInterface* p_cell =
+        problem.GetTissue()->GetCardiacCell(index);
+
+      if (p_cell->GetNumberOfStateVariables() != nb_states) {
+        const std::string err_msg = "Warm start state does not match the cell";
+        const std::string err_filename = "UterineWarmStartCache.tpp";
+        unsigned line_number = 134;
+        throw Exception(err_msg, err_filename, line_number);
+      }
+
+      AbstractUterineCompactCell::ExpandCellState(p_cell);
+      p_cell->SetStateVariables(states);
+
+      // Make CVODE start again from the new state
+      AbstractCvodeCell* p_cvode_cell = dynamic_cast<AbstractCvodeCell*>(p_cell);
+
+      if (p_cvode_cell != NULL) {
+        p_cvode_cell->ResetSolver();
+      }
+    }
+  }
+}
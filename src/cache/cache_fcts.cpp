@@ -0,0 +1,64 @@
+#include "../../include/cache/cache_fcts.hpp"
+
+std::string get_process_tag() {
+  // Host and process id, unique among the runs sharing the output folder,
+  // even across the nodes of a cluster
+  char host[256] = "";
+  gethostname(host, sizeof(host) - 1);
+  return std::string(host) + "_" + std::to_string(getpid());
+}
+
+
+std::string make_cache_tmp_dir(const std::string& cache_dir) {
+  // Named after the master process, shared by the processes of the run
+  std::string tag = get_process_tag();
+  unsigned size = tag.size();
+  MPI_Bcast(&size, 1, MPI_UNSIGNED, 0, PETSC_COMM_WORLD);
+  tag.resize(size);
+  MPI_Bcast(&tag[0], size, MPI_CHAR, 0, PETSC_COMM_WORLD);
+  const std::string tmp_dir = cache_dir + ".tmp_" + tag;
+
+  if (PetscTools::AmMaster()) {
+    // Left over by an interrupted run, it cannot be live as this process
+    // now has its host and process id
+    std::error_code error;
+    std::filesystem::remove_all(
+      OutputFileHandler::GetChasteTestOutputDirectory() + tmp_dir, error);
+  }
+  PetscTools::Barrier("make_cache_tmp_dir");
+  return tmp_dir;
+}
+
+
+void publish_cache_dir(const std::string& tmp_dir,
+                       const std::string& cache_dir, bool replace) {
+  PetscTools::Barrier("publish_cache_dir");
+
+  if (PetscTools::AmMaster()) {
+    const std::string root = OutputFileHandler::GetChasteTestOutputDirectory();
+    const std::filesystem::path tmp_path(root + tmp_dir);
+    const std::filesystem::path cache_path(root + cache_dir);
+    std::error_code error;
+    std::filesystem::rename(tmp_path, cache_path, error);
+
+    if (error && replace) {
+      // Moved aside rather than removed, so that the key is only empty
+      // between the two renames
+      std::filesystem::path old_path(root + tmp_dir);
+      old_path += ".old";
+      std::filesystem::rename(cache_path, old_path, error);
+
+      if (!error) {
+        std::filesystem::rename(tmp_path, cache_path, error);
+      }
+      std::error_code remove_error;
+      std::filesystem::remove_all(old_path, remove_error);
+    }
+
+    if (error) {
+      // Another run published the same cache first
+      std::filesystem::remove_all(tmp_path, error);
+    }
+  }
+  PetscTools::Barrier("publish_cache_dir");
+}
@@ -0,0 +1,45 @@
+#include "../../include/cells/UterineCellStatePool.hpp"
+
+#include <algorithm>
+
+UterineCellStatePool::UterineCellStatePool(unsigned long blockSize) :
+  mBlockSize(std::max(blockSize, 1ul)),
+  mNumUsed(0),
+  mNumAllocated(0) {
+}
+
+
+void* UterineCellStatePool::AllocateBytes(unsigned long numBytes) {
+  // Every allocation starts on a double boundary, the blocks are allocated
+  // with the alignment of the largest fundamental type
+  const unsigned long alignment = sizeof(double);
+  const unsigned long offset = (mNumUsed + alignment - 1) / alignment *
+    alignment;
+
+  if (mBlocks.empty() || offset + numBytes > mBlockSize) {
+    // Cells beyond the expected number get another block
+    const unsigned long block_size = std::max(mBlockSize, numBytes);
+    mBlocks.emplace_back(new unsigned char[block_size]);
+    mNumAllocated += block_size;
+    mNumUsed = numBytes;
+    return mBlocks.back().get();
+  }
+
+  mNumUsed = offset + numBytes;
+  return mBlocks.back().get() + offset;
+}
+
+
+double* UterineCellStatePool::Allocate(unsigned size) {
+  return static_cast<double*>(AllocateBytes(size * sizeof(double)));
+}
+
+
+float* UterineCellStatePool::AllocateFloats(unsigned size) {
+  return static_cast<float*>(AllocateBytes(size * sizeof(float)));
+}
+
+
+unsigned long UterineCellStatePool::GetNumBytes() const {
+  return mNumAllocated;
+}
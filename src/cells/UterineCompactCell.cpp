@@ -0,0 +1,40 @@
+#include "../../include/cells/UterineCompactCell.hpp"
+
+AbstractUterineCompactCell* AbstractUterineCompactCell::mspExpandedCell = NULL;
+std::vector<double> AbstractUterineCompactCell::msExpandedState;
+
+
+void AbstractUterineCompactCell::ExpandCellState(
+  AbstractCardiacCellInterface* pCell) {
+  AbstractUterineCompactCell* p_compact =
+    dynamic_cast<AbstractUterineCompactCell*>(pCell);
+
+  if (p_compact != NULL) {
+    p_compact->ExpandState();
+  }
+}
+
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellHodgkinHuxley1952FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellChayKeizer1983FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellMeans2023FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellMeans2023PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellTong2014FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellRoesler2024FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineCompactCell<CellRoesler2024PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellHodgkinHuxley1952FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellChayKeizer1983FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellMeans2023FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellMeans2023PFromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellTong2014FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellRoesler2024FromCellMLCvode>>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<
+  UterineCompactCell<CellRoesler2024PFromCellMLCvode>>)
@@ -0,0 +1,213 @@
+#include "../../include/cells/UterineCompactCell.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+template <class CELL>
+UterineCompactCell<CELL>::UterineCompactCell(
+  boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+  boost::shared_ptr<AbstractStimulusFunction> pStimulus) :
+  CELL(pSolver, pStimulus), AbstractUterineCompactCell() {
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::ShareParameters(
+  boost::shared_ptr<std::vector<double>> pParameters) {
+  if (pParameters->size() != this->GetNumberOfParameters()) {
+    const std::string err_msg = "Shared parameters of the wrong size";
+    const std::string err_filename = "UterineCompactCell.tpp";
+    unsigned line_number = 20;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  // The vector keeps its own storage and points to the shared values, its
+  // destruction does not free them
+  N_Vector parameters = this->mParameters;
+
+  if (NV_OWN_DATA_S(parameters)) {
+    free(NV_DATA_S(parameters));
+    NV_OWN_DATA_S(parameters) = false;
+  }
+  NV_DATA_S(parameters) = pParameters->data();
+  mpSharedParameters = pParameters;
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::SetPrivateParameter(
+  const std::string& rName, double value) {
+  if (mpSharedParameters) {
+    // Copy on write, the other cells keep the shared values. The copy is
+    // allocated as CVODE allocates its vectors, it frees it.
+    N_Vector parameters = this->mParameters;
+    double* p_values = static_cast<double*>(
+      malloc(mpSharedParameters->size() * sizeof(double)));
+    std::copy(mpSharedParameters->begin(), mpSharedParameters->end(),
+              p_values);
+
+    NV_DATA_S(parameters) = p_values;
+    NV_OWN_DATA_S(parameters) = true;
+    mpSharedParameters.reset();
+  }
+
+  this->SetParameter(rName, value);
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::UseStatePool(
+  boost::shared_ptr<UterineCellStatePool> pPool) {
+  // The values are moved to the pool, CVODE solves in place in them
+  N_Vector state = this->mStateVariables;
+  const unsigned size = this->GetNumberOfStateVariables();
+  double* p_values = pPool->Allocate(size);
+  std::copy(NV_DATA_S(state), NV_DATA_S(state) + size, p_values);
+
+  if (NV_OWN_DATA_S(state)) {
+    free(NV_DATA_S(state));
+    NV_OWN_DATA_S(state) = false;
+  }
+  NV_DATA_S(state) = p_values;
+  mpPooledState = p_values;
+  mpStatePool = pPool;
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::UseFloatState(
+  boost::shared_ptr<UterineCellStatePool> pPool) {
+  // The values are rounded to single precision in the pool, the vector has
+  // no values until the cell is expanded
+  N_Vector state = this->mStateVariables;
+  const unsigned size = this->GetNumberOfStateVariables();
+  float* p_values = pPool->AllocateFloats(size);
+  std::copy(NV_DATA_S(state), NV_DATA_S(state) + size, p_values);
+
+  if (NV_OWN_DATA_S(state)) {
+    free(NV_DATA_S(state));
+    NV_OWN_DATA_S(state) = false;
+  }
+  NV_DATA_S(state) = NULL;
+  mpFloatState = p_values;
+  mpStatePool = pPool;
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::KeepStateStorage() {
+  // SetStateVariables and ResetToInitialConditions replace the state vector
+  // by a new one with its own values, which are moved back to the pool, or
+  // to the expanded values if the cell is expanded
+  N_Vector state = this->mStateVariables;
+  double* p_values = mpPooledState;
+
+  if (mpFloatState != NULL) {
+    p_values = mspExpandedCell == this ? msExpandedState.data() : NULL;
+  } else if (mpPooledState == NULL) {
+    return;  // Own storage
+  }
+
+  if (NV_DATA_S(state) == p_values) {
+    return;
+  }
+
+  const unsigned size = this->GetNumberOfStateVariables();
+
+  if (p_values == NULL) {
+    std::copy(NV_DATA_S(state), NV_DATA_S(state) + size, mpFloatState);
+  } else {
+    std::copy(NV_DATA_S(state), NV_DATA_S(state) + size, p_values);
+  }
+
+  if (NV_OWN_DATA_S(state)) {
+    free(NV_DATA_S(state));
+    NV_OWN_DATA_S(state) = false;
+  }
+  NV_DATA_S(state) = p_values;
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::ExpandState() {
+  KeepStateStorage();
+
+  if (mpFloatState == NULL || mspExpandedCell == this) {
+    return;
+  }
+
+  if (mspExpandedCell != NULL) {
+    mspExpandedCell->CompressState();
+  }
+
+  const unsigned size = this->GetNumberOfStateVariables();
+
+  if (msExpandedState.size() < size) {
+    msExpandedState.resize(size);
+  }
+  std::copy(mpFloatState, mpFloatState + size, msExpandedState.begin());
+  NV_DATA_S(this->mStateVariables) = msExpandedState.data();
+  mspExpandedCell = this;
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::CompressState() {
+  KeepStateStorage();
+
+  if (mspExpandedCell != this) {
+    return;
+  }
+
+  // The vector loses its values, so that a use of the state without
+  // expanding it fails instead of reading the values of another cell
+  const unsigned size = this->GetNumberOfStateVariables();
+  std::copy(msExpandedState.begin(), msExpandedState.begin() + size,
+            mpFloatState);
+  NV_DATA_S(this->mStateVariables) = NULL;
+  mspExpandedCell = NULL;
+}
+
+
+template <class CELL>
+double UterineCompactCell<CELL>::GetVoltage() {
+  // Read for every node by the tissue, without expanding the cell
+  KeepStateStorage();
+
+  if (mpFloatState != NULL && mspExpandedCell != this) {
+    return mpFloatState[this->GetVoltageIndex()];
+  }
+  return CELL::GetVoltage();
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::SetVoltage(double voltage) {
+  ExpandState();
+  CELL::SetVoltage(voltage);
+}
+
+
+template <class CELL>
+double UterineCompactCell<CELL>::GetIIonic(
+  const std::vector<double>* pStateVariables) {
+  ExpandState();
+  return CELL::GetIIonic(pStateVariables);
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::SolveAndUpdateState(double tStart,
+                                                   double tEnd) {
+  // CVODE integrates in double in the expanded or pooled values
+  ExpandState();
+  CELL::SolveAndUpdateState(tStart, tEnd);
+}
+
+
+template <class CELL>
+void UterineCompactCell<CELL>::ComputeExceptVoltage(double tStart,
+                                                    double tEnd) {
+  ExpandState();
+  CELL::ComputeExceptVoltage(tStart, tEnd);
+}
@@ -0,0 +1,93 @@
+#include "../../include/cells/UterinePassiveTissueCell.hpp"
+
+#include "HeartConfig.hpp"
+#include "OdeSystemInformation.hpp"
+
+UterinePassiveTissueCell::UterinePassiveTissueCell(
+  boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+  boost::shared_ptr<AbstractStimulusFunction> pStimulus) :
+  AbstractCvodeCell(pSolver, 1, 0, pStimulus) {
+  this->mpSystemInfo =
+    OdeSystemInformation<UterinePassiveTissueCell>::Instance();
+  Init();
+
+  NV_Ith_S(this->mParameters, 0) = 0.01;  // g_leak (mS/cm2)
+  NV_Ith_S(this->mParameters, 1) = -50.0;  // E_leak (mV)
+  NV_Ith_S(this->mParameters, 2) = 1.0;  // Cm (uF/cm2)
+  NV_Ith_S(this->mParameters, 3) = 0.0;  // g_p (mS/cm2)
+}
+
+
+double UterinePassiveTissueCell::GetIIonic(
+  const std::vector<double>* pStateVariables) {
+  const double voltage = pStateVariables == NULL ?
+    NV_Ith_S(this->mStateVariables, 0) : (*pStateVariables)[0];
+  const double i_leak = NV_Ith_S(this->mParameters, 0) *
+    (voltage - NV_Ith_S(this->mParameters, 1));  // uA/cm2
+
+  // Scaled to the capacitance of the tissue, as the CellML cells
+  return i_leak * HeartConfig::Instance()->GetCapacitance() /
+    NV_Ith_S(this->mParameters, 2);
+}
+
+
+void UterinePassiveTissueCell::EvaluateYDerivatives(
+  double time, const N_Vector rY, N_Vector rDY) {
+  if (mSetVoltageDerivativeToZero) {
+    NV_Ith_S(rDY, 0) = 0.0;
+    return;
+  }
+
+  const double i_leak = NV_Ith_S(this->mParameters, 0) *
+    (NV_Ith_S(rY, 0) - NV_Ith_S(this->mParameters, 1));  // uA/cm2
+  const double i_stim = GetIntracellularAreaStimulus(time);  // uA/cm2
+  NV_Ith_S(rDY, 0) = -(i_leak + i_stim) / NV_Ith_S(this->mParameters, 2);
+}
+
+
+void UterinePassiveTissueCell::ComputeExceptVoltage(double tStart,
+                                                    double tEnd) {
+  // The voltage is the only state variable and is solved by the tissue,
+  // there is nothing left to integrate
+}
+
+
+N_Vector UterinePassiveTissueCell::ComputeDerivedQuantities(
+  double time, const N_Vector& rY) {
+  // Allocated as the derived quantities of the CellML cells, the caller
+  // frees them
+  N_Vector derived_quantities = N_VNew_Serial(1);
+  NV_Ith_S(derived_quantities, 0) = NV_Ith_S(rY, 0);  // v_p (mV)
+  return derived_quantities;
+}
+
+
+template<>
+void OdeSystemInformation<UterinePassiveTissueCell>::Initialise(void) {
+  this->mSystemName = "UterinePassiveTissueCell";
+  this->mFreeVariableName = "time";
+  this->mFreeVariableUnits = "ms";
+
+  this->mVariableNames.push_back("membrane_voltage");
+  this->mVariableUnits.push_back("mV");
+  this->mInitialConditions.push_back(-50.0);
+
+  this->mParameterNames.push_back("g_leak");
+  this->mParameterUnits.push_back("mS_per_cm2");
+  this->mParameterNames.push_back("E_leak");
+  this->mParameterUnits.push_back("mV");
+  this->mParameterNames.push_back("Cm");
+  this->mParameterUnits.push_back("uF_per_cm2");
+  this->mParameterNames.push_back("g_p");
+  this->mParameterUnits.push_back("mS_per_cm2");
+
+  this->mDerivedQuantityNames.push_back("v_p");
+  this->mDerivedQuantityUnits.push_back("mV");
+
+  this->mInitialised = true;
+}
+
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+CHASTE_CLASS_EXPORT(UterinePassiveTissueCell)
@@ -0,0 +1,11 @@
+#include "../../include/cells/UterineProfiledCell.hpp"
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellHodgkinHuxley1952FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellChayKeizer1983FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellMeans2023FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellMeans2023PFromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellTong2014FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellRoesler2024FromCellMLCvode>)
+CHASTE_CLASS_EXPORT(UterineProfiledCell<CellRoesler2024PFromCellMLCvode>)
@@ -0,0 +1,52 @@
+#include "../../include/cells/UterineProfiledCell.hpp"
+
+template <class CELL>
+UterineProfiledCell<CELL>::UterineProfiledCell(
+  boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+  boost::shared_ptr<AbstractStimulusFunction> pStimulus) :
+  CELL(pSolver, pStimulus), AbstractUterineCellProfile() {
+}
+
+
+template <class CELL>
+void UterineProfiledCell<CELL>::AddSolve(
+  std::chrono::steady_clock::time_point start) {
+  const std::chrono::duration<double> time =
+    std::chrono::steady_clock::now() - start;
+  mOdeTime += time.count();
+
+  // The solver is reinitialised at each solve in the tissue, as the voltage
+  // changes between them, so its step count only covers this solve
+  if (this->mpCvodeMem != NULL) {
+    long int num_steps = 0;
+    CVodeGetNumSteps(this->mpCvodeMem, &num_steps);
+    mNumCvodeSteps += num_steps;
+  }
+}
+
+
+template <class CELL>
+void UterineProfiledCell<CELL>::EvaluateYDerivatives(
+  double time, const N_Vector rY, N_Vector rDY) {
+  ++mNumRhsEvaluations;
+  CELL::EvaluateYDerivatives(time, rY, rDY);
+}
+
+
+template <class CELL>
+void UterineProfiledCell<CELL>::SolveAndUpdateState(double tStart,
+                                                    double tEnd) {
+  const auto start = std::chrono::steady_clock::now();
+  CELL::SolveAndUpdateState(tStart, tEnd);
+  AddSolve(start);
+}
+
+
+template <class CELL>
+void UterineProfiledCell<CELL>::ComputeExceptVoltage(double tStart,
+                                                     double tEnd) {
+  // Used by the monodomain tissue, the voltage comes from the PDE
+  const auto start = std::chrono::steady_clock::now();
+  CELL::ComputeExceptVoltage(tStart, tEnd);
+  AddSolve(start);
+}
@@ -1,5 +1,8 @@
 #include "../../include/conductivity/UterineConductivityModifier.hpp"
 
+unsigned long UterineConductivityModifier::mNumCalls = 0;
+double UterineConductivityModifier::mElapsedTime = 0.0;
+
 
 UterineConductivityModifier::UterineConductivityModifier() :
   AbstractConductivityModifier<3, 3>(),
@@ -33,6 +36,8 @@ c_matrix<double, 3, 3>& UterineConductivityModifier::rCalculateModifiedConductiv
     return mSpecialMatrix;
   }
 
+  const auto start = std::chrono::steady_clock::now();
+
   // Get current element centroid to calculate position-based variations
   Element<3, 3>* element = (mMesh->GetElement(elementIndex));
   c_vector<double, 3> cur_centroid = element->CalculateCentroid();
@@ -50,6 +55,10 @@ c_matrix<double, 3, 3>& UterineConductivityModifier::rCalculateModifiedConductiv
                                              mSlope, mCentre, mAmplitude);
     }
   }
+  const std::chrono::duration<double, std::milli> time =
+    std::chrono::steady_clock::now() - start;
+  ++mNumCalls;
+  mElapsedTime += time.count();
   return mTensor;
 }
 
@@ -58,3 +67,26 @@ c_matrix<double, 3, 3>& UterineConductivityModifier::rCalculateModifiedConductiv
 AbstractTetrahedralMesh<3, 3>* UterineConductivityModifier::GetMesh() {
   return mMesh;
 }
+
+
+// Setter
+void UterineConductivityModifier::SetMesh(AbstractTetrahedralMesh<3, 3>* mesh) {
+  mMesh = mesh;
+}
+
+
+void UterineConductivityModifier::ResetTimer() {
+  mNumCalls = 0;
+  mElapsedTime = 0.0;
+}
+
+
+unsigned long UterineConductivityModifier::GetNumCalls() {
+  return mNumCalls;
+}
+
+
+// In ms, as the event handlers
+double UterineConductivityModifier::GetElapsedTime() {
+  return mElapsedTime;
+}
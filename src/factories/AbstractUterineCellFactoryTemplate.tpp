@@ -3,7 +3,10 @@
 
 template <int DIM>
 AbstractUterineCellFactoryTemplate<DIM>::AbstractUterineCellFactoryTemplate() : 
-  AbstractCardiacCellFactory<DIM>() {
+  AbstractCardiacCellFactory<DIM>(), mpProfile_cells(false),
+  mpShare_parameters(false), mpPool_states(false), mpFloat_states(false),
+  mpPassive_tissue_label(-1), mpPassive_tissue_g_leak(0.01),
+  mpPassive_tissue_e_leak(-50.0) {
     if (DIM == 2) {
       ReadParams(USMC_SYSTEM_CONSTANTS::GENERAL_2D_PARAM_FILE);
     } else if (DIM == 3) {
@@ -11,7 +14,7 @@ AbstractUterineCellFactoryTemplate<DIM>::AbstractUterineCellFactoryTemplate() :
     } else {
       const std::string err_msg = "Invalid dimension";
       const std::string err_filename = "AbstractUterineCellFactoryTemplate.tpp";
-      unsigned line_number = 14;
+      unsigned line_number = 17;
       throw Exception(err_msg, err_filename, line_number);
     }
 }
@@ -28,6 +31,10 @@ AbstractCvodeCell* AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellFor
   AbstractCvodeCell* cell(nullptr);
   double z;
 
+  if (IsPassiveTissue(pNode)) {
+    return CreatePassiveTissueCell();
+  }
+
   // Initialise cell with ZeroStimulus
   this->InitCell(cell, this->mpZeroStimulus);
 
@@ -68,9 +75,24 @@ template <int DIM>
 void AbstractUterineCellFactoryTemplate<DIM>::ReadParams(std::string general_param_file) {
   std::string general_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     general_param_file;
-  const auto params = toml::parse(general_param_path);
+  const auto params = read_config(general_param_path, "general");
 
   mpCell_type = toml::find<std::string>(params, "cell_type");
+  mpProfile_cells = toml::find_or<bool>(params, "cell_profiling", false);
+  mpShare_parameters = toml::find_or<bool>(params, "shared_parameters",
+                                           false);
+  mpPool_states = toml::find_or<bool>(params, "pooled_states", false);
+  mpFloat_states = toml::find_or<bool>(params, "float_states", false);
+  mpPassive_tissue_label = toml::find_or<int>(params, "passive_tissue_label",
+                                              -1);
+  mpPassive_tissue_g_leak = toml::find_or<double>(
+    params, "passive_tissue_g_leak", 0.01);
+  mpPassive_tissue_e_leak = toml::find_or<double>(
+    params, "passive_tissue_e_leak", -50.0);
+  ReadPassiveTissueRegions(
+    "mesh/" + toml::find<std::string>(params, "mesh_name") + ".toml",
+    toml::find_or<std::vector<std::string>>(params, "passive_tissue_regions",
+                                            std::vector<std::string>()));
 
   if ((mpCell_type == std::string("Roesler")) || (mpCell_type == std::string("RoeslerP"))) {
     // Get the estrus phase as well
@@ -90,7 +112,7 @@ template <int DIM>
 void AbstractUterineCellFactoryTemplate<DIM>::ReadCellParams(std::string cell_param_file) {
   std::string cell_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     cell_param_file;
-  const auto cell_params = toml::parse(cell_param_path);
+  const auto cell_params = read_config(cell_param_path, "cell");
 
   mpCell_id = toml::find<std::int16_t>(cell_params, "cell_id");
 
@@ -123,12 +145,126 @@ void AbstractUterineCellFactoryTemplate<DIM>::SetCellParams(
             cell->SetParameter(it->first, it->second);
         }
   }
+
+  AbstractUterineCompactCell* p_shared =
+    dynamic_cast<AbstractUterineCompactCell*>(cell);
+
+  if (mpShare_parameters && p_shared != NULL) {
+    // All the cells of a model have the same parameters at this point, the
+    // first one gives the shared values
+    boost::shared_ptr<std::vector<double>>& rp_parameters =
+      mpShared_parameters[cell->GetSystemName()];
+
+    if (!rp_parameters) {
+      rp_parameters.reset(
+        new std::vector<double>(cell->GetNumberOfParameters()));
+
+      for (unsigned i = 0; i < rp_parameters->size(); ++i) {
+        (*rp_parameters)[i] = cell->GetParameter(i);
+      }
+    }
+    p_shared->ShareParameters(rp_parameters);
+  }
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetNodeParameter(
+  AbstractCvodeCell* cell, const std::string& name, double value) {
+  // Cells sharing their parameters get their own copy first
+  AbstractUterineCompactCell* p_shared =
+    dynamic_cast<AbstractUterineCompactCell*>(cell);
+
+  if (p_shared != NULL) {
+    p_shared->SetPrivateParameter(name, value);
+  } else {
+    cell->SetParameter(name, value);
+  }
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::ReadPassiveTissueRegions(
+  std::string mesh_param_file, const std::vector<std::string>& rRegions) {
+  mpPassive_tissue_boxes.clear();
+
+  if (rRegions.empty()) {
+    return;
+  }
+
+  std::string mesh_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+    mesh_param_file;
+  const auto mesh_params = read_config(mesh_param_path, "mesh");
+
+  // The regions are the ones of the region stimulus, in each horn
+  for (const std::string horn : {"left", "right"}) {
+    if (!mesh_params.contains(horn)) {
+      continue;
+    }
+
+    const auto& horn_params = toml::find(mesh_params, horn);
+
+    for (const std::string& region : rRegions) {
+      if (!horn_params.contains(region)) {
+        const std::string err_msg = "Invalid passive tissue region " + region;
+        const std::string err_filename = "AbstractUterineCellFactoryTemplate.tpp";
+        unsigned line_number = 211;
+        throw Exception(err_msg, err_filename, line_number);
+      }
+
+      const auto& region_params = toml::find(horn_params, region);
+      mpPassive_tissue_boxes.push_back({
+        toml::find<double>(horn_params, "x_start"),
+        toml::find<double>(horn_params, "x_end"),
+        toml::find<double>(horn_params, "y_start"),
+        toml::find<double>(horn_params, "y_end"),
+        toml::find<double>(region_params, "z_start"),
+        toml::find<double>(region_params, "z_end")});
+    }
+  }
+}
+
+
+template <int DIM>
+bool AbstractUterineCellFactoryTemplate<DIM>::IsPassiveTissue(
+  Node<DIM>* pNode) {
+  // Labelled through the first attribute of the node in the mesh
+  if (mpPassive_tissue_label >= 0 && pNode->GetNumNodeAttributes() > 0 &&
+      pNode->rGetNodeAttributes()[0] == mpPassive_tissue_label) {
+    return true;
+  }
+
+  const c_vector<double, DIM>& r_location = pNode->rGetLocation();
+
+  for (const std::vector<double>& r_box : mpPassive_tissue_boxes) {
+    if (r_location[0] >= r_box[0] && r_location[0] <= r_box[1] &&
+        r_location[1] >= r_box[2] && r_location[1] <= r_box[3] &&
+        (DIM == 2 ||
+         (r_location[2] >= r_box[4] && r_location[2] <= r_box[5]))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+template <int DIM>
+AbstractCvodeCell* AbstractUterineCellFactoryTemplate<DIM>::CreatePassiveTissueCell() {
+  // Non-excitable nodes are not stimulated and start at rest
+  AbstractCvodeCell* cell = new UterinePassiveTissueCell(this->mpSolver,
+                                                         this->mpZeroStimulus);
+  cell->SetParameter("g_leak", mpPassive_tissue_g_leak);
+  cell->SetParameter("E_leak", mpPassive_tissue_e_leak);
+  cell->SetVoltage(mpPassive_tissue_e_leak);
+  return cell;
 }
 
 
 template <int DIM>
 void AbstractUterineCellFactoryTemplate<DIM>::SetPassiveParams(
   AbstractCvodeCell* cell, double z) {
+  UterineEventHandler::BeginEvent(UterineEventHandler::SET_PASSIVE_PARAMS);
+
   if (mpCell_id > 1) {
     double slope;  // Slope of the distribution
     double centre;  // Centre of the distribution
@@ -148,9 +284,11 @@ void AbstractUterineCellFactoryTemplate<DIM>::SetPassiveParams(
           } else if (it->first == "amplitude") {
             amplitude = it->second;
           } else {
+            UterineEventHandler::EndEvent(
+              UterineEventHandler::SET_PASSIVE_PARAMS);
             const std::string err_msg = "Invalid passive paramter";
             const std::string err_filename = "AbstractUterineCellFactoryTemplate.tpp";
-            unsigned line_number = 153;
+            unsigned line_number = 291;
             throw Exception(err_msg, err_filename, line_number);
           }
     }
@@ -161,14 +299,62 @@ void AbstractUterineCellFactoryTemplate<DIM>::SetPassiveParams(
       conductance_value = gaussian_distribution(z, baseline, slope, centre,
                                                 amplitude);
     } else {
+      UterineEventHandler::EndEvent(UterineEventHandler::SET_PASSIVE_PARAMS);
       const std::string err_msg = "Invalid distribution";
       const std::string err_filename = "AbstractUterineCellFactoryTemplate.tpp";
-      unsigned line_number = 166;
+      unsigned line_number = 305;
       throw Exception(err_msg, err_filename, line_number);
     }
 
-    cell->SetParameter("g_p", conductance_value);
+    SetNodeParameter(cell, "g_p", conductance_value);
   }
+  UterineEventHandler::EndEvent(UterineEventHandler::SET_PASSIVE_PARAMS);
+}
+
+
+template <int DIM>
+template <class CELL>
+AbstractCvodeCell* AbstractUterineCellFactoryTemplate<DIM>::NewCell(
+  boost::shared_ptr<AbstractStimulusFunction> stimulus) {
+  // The passive models are excluded from single precision, their v_p output
+  // is read from the state directly by the tissue
+  const bool float_state = mpFloat_states && mpCell_type.back() != 'P';
+
+  if (!mpShare_parameters && !mpPool_states && !float_state) {
+    if (mpProfile_cells) {
+      return new UterineProfiledCell<CELL>(this->mpSolver, stimulus);
+    }
+    return new CELL(this->mpSolver, stimulus);
+  }
+
+  UterineCompactCell<CELL>* p_cell(nullptr);
+
+  if (mpProfile_cells) {
+    p_cell = new UterineProfiledCell<UterineCompactCell<CELL>>(
+      this->mpSolver, stimulus);
+  } else {
+    p_cell = new UterineCompactCell<CELL>(this->mpSolver, stimulus);
+  }
+
+  if (mpPool_states || float_state) {
+    if (!mpState_pool) {
+      // Blocks of the states of a fixed number of cells, cells can be
+      // created without a mesh. Pages of the last block that are not used
+      // are not resident.
+      const unsigned long cells_per_block = 4096;
+      const unsigned long value_size = float_state ? sizeof(float) :
+        sizeof(double);
+      mpState_pool.reset(new UterineCellStatePool(
+        cells_per_block * p_cell->GetNumberOfStateVariables() * value_size));
+    }
+
+    if (float_state) {
+      p_cell->UseFloatState(mpState_pool);
+    } else {
+      p_cell->UseStatePool(mpState_pool);
+    }
+  }
+  return p_cell;
 }
 
 
@@ -177,38 +363,37 @@ void AbstractUterineCellFactoryTemplate<DIM>::InitCell(AbstractCvodeCell*& cell,
                                                        boost::shared_ptr<AbstractStimulusFunction> stim) {
   switch (mpCell_id) {
     case 0:
-      cell = new CellHodgkinHuxley1952FromCellMLCvode(this->mpSolver,
-        stim);
+      cell = NewCell<CellHodgkinHuxley1952FromCellMLCvode>(stim);
       break;
 
     case 1:
-      cell = new CellChayKeizer1983FromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellChayKeizer1983FromCellMLCvode>(stim);
       break;
 
     case 2:
-      cell = new CellMeans2023FromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellMeans2023FromCellMLCvode>(stim);
       break;
 
     case 3:
-      cell = new CellTong2014FromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellTong2014FromCellMLCvode>(stim);
       break;
 
     case 4:
-      cell = new CellRoesler2024FromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellRoesler2024FromCellMLCvode>(stim);
       break;
 
     case 5:
-      cell = new CellRoesler2024PFromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellRoesler2024PFromCellMLCvode>(stim);
       break;
 
     case 6:
-      cell = new CellMeans2023PFromCellMLCvode(this->mpSolver, stim);
+      cell = NewCell<CellMeans2023PFromCellMLCvode>(stim);
       break;
 
     default:
       const std::string err_msg = "Invalid cell type";
       const std::string err_filename = "AbstractUterineCellFactoryTemplate.tpp";
-      unsigned line_number = 211;
+      unsigned line_number = 396;
       throw Exception(err_msg, err_filename, line_number);
   }
 }
@@ -266,3 +451,47 @@ template <int DIM>
 void AbstractUterineCellFactoryTemplate<DIM>::SetEstrus(std::string estrus) {
   mpEstrus = estrus;
 }
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetProfileCells(
+  bool profile_cells) {
+  mpProfile_cells = profile_cells;
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetShareParameters(
+  bool share_parameters) {
+  mpShare_parameters = share_parameters;
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetPoolStates(
+  bool pool_states) {
+  mpPool_states = pool_states;
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetFloatStates(
+  bool float_states) {
+  mpFloat_states = float_states;
+}
+
+
+template <int DIM>
+void AbstractUterineCellFactoryTemplate<DIM>::SetPassiveTissueLabel(
+  int label) {
+  mpPassive_tissue_label = label;
+}
+
+
+template <int DIM>
+unsigned AbstractUterineCellFactoryTemplate<DIM>::GetStimulusRegion(
+  const std::vector<double>& rLocation) {
+  // 0 outside of the stimulus, the factories with a stimulus number theirs
+  // from 1
+  return 0;
+}
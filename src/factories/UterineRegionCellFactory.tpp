@@ -30,12 +30,23 @@ UterineRegionCellFactory<DIM>::UterineRegionCellFactory() :
 template <int DIM>
 AbstractCvodeCell* UterineRegionCellFactory<DIM>::CreateCardiacCellForTissueNode(
   Node<DIM>* pNode) {
+  UterineEventHandler::BeginEvent(UterineEventHandler::CREATE_REGION_CELL);
+
+  // Non-excitable nodes are not stimulated
+  if (this->IsPassiveTissue(pNode)) {
+    UterineEventHandler::EndEvent(UterineEventHandler::CREATE_REGION_CELL);
+    return this->CreatePassiveTissueCell();
+  }
+
   double x = pNode->rGetLocation()[0];
   double y = pNode->rGetLocation()[1];
   double z = pNode->rGetLocation()[2];
 
+  UterineEventHandler::BeginEvent(UterineEventHandler::FIND_REGION);
   unsigned region = FindRegion(x, y, z);
+  UterineEventHandler::EndEvent(UterineEventHandler::FIND_REGION);
   boost::shared_ptr<UterineRegionStimulus> stimulus;
+  AbstractCvodeCell* cell;
 
   switch (region) {
     case 1:
@@ -48,16 +59,17 @@ AbstractCvodeCell* UterineRegionCellFactory<DIM>::CreateCardiacCellForTissueNode
       stimulus = mpCervicalStimulus;
       break;
     default:
-      return this->CreateCardiacCellForTissueNode(
+      cell = AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellForTissueNode(
         pNode);
+      UterineEventHandler::EndEvent(UterineEventHandler::CREATE_REGION_CELL);
+      return cell;
   }
 
   stimulus->SetRegion(region);
 
-  AbstractCvodeCell* cell;
-
   this->InitCell(cell, stimulus);
   this->SetCellParams(cell);
+  UterineEventHandler::EndEvent(UterineEventHandler::CREATE_REGION_CELL);
   return cell;
 }
 
@@ -77,6 +89,14 @@ unsigned UterineRegionCellFactory<DIM>::FindRegion(double x, double y, double z)
 }
 
 
+template <int DIM>
+unsigned UterineRegionCellFactory<DIM>::GetStimulusRegion(
+  const std::vector<double>& rLocation) {
+  return FindRegion(rLocation[0], rLocation[1],
+                    DIM == 3 ? rLocation[2] : 0.0);
+}
+
+
 template <int DIM>
 unsigned UterineRegionCellFactory<DIM>::IsInLeft(double x, double y, double z) {
   unsigned region = 0;
@@ -117,15 +137,19 @@ unsigned UterineRegionCellFactory<DIM>::IsInRight(double x, double y, double z)
 
 template <int DIM>
 void UterineRegionCellFactory<DIM>::ReadParams(std::string general_param_file) {
-  this->ReadParams(general_param_file);
+  AbstractUterineCellFactoryTemplate<DIM>::ReadParams(general_param_file);
 
   // Read region stimulus specific parameters
   std::string general_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     general_param_file;
-  const auto params = toml::parse(general_param_path);
+  const auto params = read_config(general_param_path, "general");
   std::string mesh_name = toml::find<std::string>(
     params, "mesh_name");  // Get mesh name
 
+  // Seed of the region selection, Monte Carlo runs derive their streams
+  // from it
+  GetSelector()->SetSeed(toml::find_or<unsigned>(params, "region_seed", 982));
+
   // Get mesh stimulus locations
   const auto mesh_param_file = "mesh/" + mesh_name + ".toml";
 
@@ -138,7 +162,7 @@ template <int DIM>
 void UterineRegionCellFactory<DIM>::ReadCellParams(std::string cell_param_file) {
   std::string cell_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     cell_param_file;
-  const auto cell_params = toml::parse(cell_param_path);
+  const auto cell_params = read_config(cell_param_path, "cell");
 
   // Stimulus parameters
   auto magnitude = toml::find<double>(cell_params, "magnitude");
@@ -161,7 +185,7 @@ void UterineRegionCellFactory<DIM>::ReadMeshParams(
   std::string mesh_param_file, std::string horn) {
   std::string mesh_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     mesh_param_file;
-  auto mesh_params = toml::parse(mesh_param_path);
+  auto mesh_params = read_config(mesh_param_path, "mesh");
 
 
   // Read horn specific parameters
@@ -247,9 +271,16 @@ void UterineRegionCellFactory<DIM>::SetStimulusParams(
 }
 
 
+template <int DIM>
+boost::shared_ptr<UterineRegionSelector> UterineRegionCellFactory<DIM>::GetSelector() {
+  // The three stimuli share the same selector
+  return mpOvariesStimulus->GetSelector();
+}
+
+
 template <int DIM>
 void UterineRegionCellFactory<DIM>::PrintParams() {
-  this->PrintParams();
+  AbstractUterineCellFactoryTemplate<DIM>::PrintParams();
   std::cout << "stimulus magnitude = "
     << mpOvariesStimulus->GetMagnitude()
     << std::endl;
@@ -286,7 +317,7 @@ void UterineRegionCellFactory<DIM>::PrintParams() {
 
 template <int DIM>
 void UterineRegionCellFactory<DIM>::WriteLogInfo(std::string log_file) {
-  this->WriteLogInfo(log_file);
+  AbstractUterineCellFactoryTemplate<DIM>::WriteLogInfo(log_file);
 
   std::ofstream log_stream;
   log_stream.open(log_file, ios::app);  // Open log file in append mode
@@ -23,6 +23,14 @@ UterineSimpleCellFactory<DIM>::UterineSimpleCellFactory() :
 template <int DIM>
 AbstractCvodeCell* UterineSimpleCellFactory<DIM>::CreateCardiacCellForTissueNode(
   Node<DIM>* pNode) {
+  UterineEventHandler::BeginEvent(UterineEventHandler::CREATE_SIMPLE_CELL);
+
+  // Non-excitable nodes are not stimulated
+  if (this->IsPassiveTissue(pNode)) {
+    UterineEventHandler::EndEvent(UterineEventHandler::CREATE_SIMPLE_CELL);
+    return this->CreatePassiveTissueCell();
+  }
+
   double x = pNode->rGetLocation()[0];
   double y = pNode->rGetLocation()[1];
   double z;
@@ -39,12 +47,28 @@ AbstractCvodeCell* UterineSimpleCellFactory<DIM>::CreateCardiacCellForTissueNode
       AbstractUterineCellFactoryTemplate<DIM>::InitCell(cell, this->mpStimulus);
       AbstractUterineCellFactoryTemplate<DIM>::SetCellParams(cell);
     }
-    return cell;
 
   } else {
     /* The other cells have zero stimuli. */
-    return AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellForTissueNode(pNode);
+    cell = AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellForTissueNode(pNode);
+  }
+
+  UterineEventHandler::EndEvent(UterineEventHandler::CREATE_SIMPLE_CELL);
+  return cell;
+}
+
+
+template <int DIM>
+unsigned UterineSimpleCellFactory<DIM>::GetStimulusRegion(
+  const std::vector<double>& rLocation) {
+  // 1 within the stimulated box
+  if (rLocation[0] >= mpX_stim_start && rLocation[0] <= mpX_stim_end &&
+      rLocation[1] >= mpY_stim_start && rLocation[1] <= mpY_stim_end &&
+      (DIM == 2 ||
+       (rLocation[2] >= mpZ_stim_start && rLocation[2] <= mpZ_stim_end))) {
+    return 1;
   }
+  return 0;
 }
 
 
@@ -54,7 +78,7 @@ void UterineSimpleCellFactory<DIM>::ReadParams(std::string general_param_file) {
 
   std::string general_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     general_param_file;
-  const auto params = toml::parse(general_param_path);
+  const auto params = read_config(general_param_path, "general");
 
   // Stimulus location parameters
   mpX_stim_start = toml::find<double>(params, "x_stim_start");
@@ -76,7 +100,7 @@ template <int DIM>
 void UterineSimpleCellFactory<DIM>::ReadCellParams(std::string cell_param_file) {
   std::string cell_param_path = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
     cell_param_file;
-  const auto cell_params = toml::parse(cell_param_path);
+  const auto cell_params = read_config(cell_param_path, "cell");
 
   // Stimulus parameters
   mpStimulus->SetMagnitude(toml::find<double>(cell_params, "magnitude"));
@@ -11,7 +11,11 @@ UterineZeroCellFactory<DIM>::UterineZeroCellFactory() :
 template <int DIM>
 AbstractCvodeCell* UterineZeroCellFactory<DIM>::CreateCardiacCellForTissueNode(
   Node<DIM>* pNode) {
-  return AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellForTissueNode(pNode);
+  UterineEventHandler::BeginEvent(UterineEventHandler::CREATE_ZERO_CELL);
+  AbstractCvodeCell* cell =
+    AbstractUterineCellFactoryTemplate<DIM>::CreateCardiacCellForTissueNode(pNode);
+  UterineEventHandler::EndEvent(UterineEventHandler::CREATE_ZERO_CELL);
+  return cell;
 }
 
 
@@ -0,0 +1,190 @@
+#include "../../include/problem/UterineActivationStatistics.hpp"
+
+UterineActivationStatistics::UterineActivationStatistics(
+  const std::string& rFilename, double threshold) :
+  AbstractOutputModifier(rFilename),
+  mThreshold(threshold),
+  mLow(0),
+  mNumRealisations(0) {
+}
+
+
+void UterineActivationStatistics::InitialiseAtStart(
+  DistributedVectorFactory* pVectorFactory) {
+  // Called at every solve, only allocate for the first one so that the
+  // statistics carry over chunked solves and realisations
+  const unsigned num_local = pVectorFactory->GetLocalOwnership();
+
+  if (mNumActivations.size() == num_local) {
+    return;
+  }
+
+  mLow = pVectorFactory->GetLow();
+  mNumActivations.assign(num_local, 0);
+  mMeans.assign(num_local, 0.0);
+  mSquaredDeviations.assign(num_local, 0.0);
+  StartRealisation();
+}
+
+
+void UterineActivationStatistics::FinaliseAtEnd() {
+}
+
+
+void UterineActivationStatistics::ProcessSolutionAtTimeStep(
+  double time, Vec solution, unsigned problemDim) {
+  // The voltage is the first of the problemDim values of each node
+  const double* p_values;
+  VecGetArrayRead(solution, &p_values);
+
+  for (unsigned i = 0; i < mActivationTimes.size(); ++i) {
+    const double voltage = p_values[i*problemDim];
+
+    // Upstroke through the threshold, the first sample cannot be one
+    if (mActivationTimes[i] < 0.0 && voltage >= mThreshold &&
+        mPreviousVoltages[i] < mThreshold) {
+      mActivationTimes[i] = time;
+    }
+    mPreviousVoltages[i] = voltage;
+  }
+
+  VecRestoreArrayRead(solution, &p_values);
+}
+
+
+void UterineActivationStatistics::StartRealisation() {
+  mPreviousVoltages.assign(mNumActivations.size(),
+                           std::numeric_limits<double>::quiet_NaN());
+  mActivationTimes.assign(mNumActivations.size(), -1.0);
+}
+
+
+double UterineActivationStatistics::EndRealisation() {
+  // Add the activation times to the running statistics
+  unsigned local_activated = 0;
+
+  for (unsigned i = 0; i < mActivationTimes.size(); ++i) {
+    if (mActivationTimes[i] < 0.0) {
+      continue;
+    }
+
+    ++local_activated;
+    ++mNumActivations[i];
+    const double delta = mActivationTimes[i] - mMeans[i];
+    mMeans[i] += delta / mNumActivations[i];
+    mSquaredDeviations[i] += delta * (mActivationTimes[i] - mMeans[i]);
+  }
+  ++mNumRealisations;
+
+  // Fraction of the tissue activated in this realisation
+  unsigned local_counts[2] = {local_activated,
+    static_cast<unsigned>(mActivationTimes.size())};
+  unsigned counts[2] = {0, 0};
+  MPI_Allreduce(local_counts, counts, 2, MPI_UNSIGNED, MPI_SUM,
+                PETSC_COMM_WORLD);
+
+  return counts[1] == 0 ? 0.0 : static_cast<double>(counts[0]) / counts[1];
+}
+
+
+unsigned UterineActivationStatistics::GetNumRealisations() {
+  return mNumRealisations;
+}
+
+
+double UterineActivationStatistics::GetActivationTime(unsigned index) {
+  return mActivationTimes[index - mLow];
+}
+
+
+double UterineActivationStatistics::GetActivationProbability(unsigned index) {
+  if (mNumRealisations == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(mNumActivations[index - mLow]) /
+    mNumRealisations;
+}
+
+
+double UterineActivationStatistics::GetMeanActivationTime(unsigned index) {
+  // -1 if the node never activated, as for a single activation time
+  return mNumActivations[index - mLow] == 0 ? -1.0 : mMeans[index - mLow];
+}
+
+
+double UterineActivationStatistics::GetActivationTimeStd(unsigned index) {
+  const unsigned num_activations = mNumActivations[index - mLow];
+
+  if (num_activations == 0) {
+    return -1.0;
+  } else if (num_activations == 1) {
+    return 0.0;
+  }
+  return std::sqrt(mSquaredDeviations[index - mLow] / (num_activations - 1));
+}
+
+
+void UterineActivationStatistics::WriteStatistics(
+  const std::string& file_path, const std::vector<unsigned>& rPermutation) {
+  // Nodes are written in the order of the original mesh
+  std::vector<unsigned> original_indices;
+
+  if (!rPermutation.empty()) {
+    original_indices.resize(rPermutation.size());
+
+    for (unsigned i = 0; i < rPermutation.size(); ++i) {
+      original_indices[rPermutation[i]] = i;
+    }
+  }
+
+  // Node index, probability, mean and standard deviation of each node
+  std::vector<double> local_rows;
+
+  for (unsigned i = 0; i < mNumActivations.size(); ++i) {
+    const unsigned index = mLow + i;
+    local_rows.push_back(rPermutation.empty() ? index :
+                         original_indices[index]);
+    local_rows.push_back(GetActivationProbability(index));
+    local_rows.push_back(GetMeanActivationTime(index));
+    local_rows.push_back(GetActivationTimeStd(index));
+  }
+
+  const int local_size = local_rows.size();
+  std::vector<int> sizes(PetscTools::GetNumProcs());
+  MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0,
+             PETSC_COMM_WORLD);
+
+  std::vector<int> offsets(sizes.size(), 0);
+
+  for (unsigned i = 1; i < sizes.size(); ++i) {
+    offsets[i] = offsets[i - 1] + sizes[i - 1];
+  }
+
+  std::vector<double> rows(offsets.back() + sizes.back());
+  MPI_Gatherv(local_rows.data(), local_size, MPI_DOUBLE, rows.data(),
+              sizes.data(), offsets.data(), MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::vector<unsigned> order(rows.size() / 4);
+
+  for (unsigned i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&rows](unsigned a, unsigned b) {
+    return rows[4*a] < rows[4*b];
+  });
+
+  std::ofstream stats_file(file_path);
+  stats_file << "node,probability,mean_activation_time,std_activation_time"
+    << std::endl;
+
+  for (const unsigned row : order) {
+    stats_file << static_cast<unsigned>(rows[4*row]) << ","
+      << rows[4*row + 1] << "," << rows[4*row + 2] << ","
+      << rows[4*row + 3] << std::endl;
+  }
+  stats_file.close();
+}
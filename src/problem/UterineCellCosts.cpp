@@ -0,0 +1,164 @@
+#include "../../include/problem/UterineCellCosts.hpp"
+
+UterineCellCosts::UterineCellCosts(
+  const std::vector<AbstractCardiacCellInterface*>& rCells, unsigned low,
+  double odeTime) :
+  mLow(low),
+  mNumProfiled(0),
+  mOdeTime(odeTime),
+  mCellTimes(rCells.size(), 0.0),
+  mRhsEvaluations(rCells.size(), 0.0),
+  mCvodeSteps(rCells.size(), 0.0) {
+  for (unsigned i = 0; i < rCells.size(); ++i) {
+    // Cells loaded from a checkpoint saved without profiling are not
+    const AbstractUterineCellProfile* p_profile =
+      dynamic_cast<const AbstractUterineCellProfile*>(rCells[i]);
+
+    if (p_profile == NULL) {
+      continue;
+    }
+
+    ++mNumProfiled;
+    mCellTimes[i] = p_profile->GetOdeTime();
+    mRhsEvaluations[i] = p_profile->GetNumRhsEvaluations();
+    mCvodeSteps[i] = p_profile->GetNumCvodeSteps();
+  }
+}
+
+
+unsigned UterineCellCosts::GetNumProfiled() {
+  return mNumProfiled;
+}
+
+
+void UterineCellCosts::WriteCostMap(
+  const std::string& file_path, const std::vector<unsigned>& rPermutation) {
+  // Nodes are written in the order of the original mesh, as the activation
+  // statistics, so that the map can be used with another partition
+  std::vector<unsigned> original_indices;
+
+  if (!rPermutation.empty()) {
+    original_indices.resize(rPermutation.size());
+
+    for (unsigned i = 0; i < rPermutation.size(); ++i) {
+      original_indices[rPermutation[i]] = i;
+    }
+  }
+
+  // Node index, ODE time, RHS evaluations and CVODE steps of each node
+  std::vector<double> local_rows;
+
+  for (unsigned i = 0; i < mCellTimes.size(); ++i) {
+    const unsigned index = mLow + i;
+    local_rows.push_back(rPermutation.empty() ? index :
+                         original_indices[index]);
+    local_rows.push_back(mCellTimes[i]);
+    local_rows.push_back(mRhsEvaluations[i]);
+    local_rows.push_back(mCvodeSteps[i]);
+  }
+
+  const int local_size = local_rows.size();
+  std::vector<int> sizes(PetscTools::GetNumProcs());
+  MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0,
+             PETSC_COMM_WORLD);
+
+  std::vector<int> offsets(sizes.size(), 0);
+
+  for (unsigned i = 1; i < sizes.size(); ++i) {
+    offsets[i] = offsets[i - 1] + sizes[i - 1];
+  }
+
+  std::vector<double> rows(offsets.back() + sizes.back());
+  MPI_Gatherv(local_rows.data(), local_size, MPI_DOUBLE, rows.data(),
+              sizes.data(), offsets.data(), MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::vector<unsigned> order(rows.size() / 4);
+
+  for (unsigned i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&rows](unsigned a, unsigned b) {
+    return rows[4*a] < rows[4*b];
+  });
+
+  std::ofstream cost_file(file_path);
+  cost_file << "node,ode_time,rhs_evaluations,cvode_steps" << std::endl;
+
+  for (const unsigned row : order) {
+    cost_file << static_cast<unsigned>(rows[4*row]) << ","
+      << rows[4*row + 1] << ","
+      << static_cast<unsigned long>(rows[4*row + 2]) << ","
+      << static_cast<unsigned long>(rows[4*row + 3]) << std::endl;
+  }
+  cost_file.close();
+}
+
+
+void UterineCellCosts::WriteRankCounters(const std::string& file_path,
+                                         UterineRunManifest* pManifest) {
+  // Cells, RHS evaluations, CVODE steps, cell time and ODE time of each
+  // process, on all of them for the imbalance
+  const unsigned num_values = 5;
+  double local_values[num_values] = {
+    static_cast<double>(mCellTimes.size()), 0.0, 0.0, 0.0, mOdeTime};
+
+  for (unsigned i = 0; i < mCellTimes.size(); ++i) {
+    local_values[1] += mRhsEvaluations[i];
+    local_values[2] += mCvodeSteps[i];
+    local_values[3] += mCellTimes[i];
+  }
+
+  const unsigned num_procs = PetscTools::GetNumProcs();
+  std::vector<double> values(num_values*num_procs);
+  MPI_Allgather(local_values, num_values, MPI_DOUBLE, values.data(),
+                num_values, MPI_DOUBLE, PETSC_COMM_WORLD);
+
+  // Slowest process over the average one, 1 when balanced
+  std::vector<double> max_values(num_values, 0.0);
+  std::vector<double> mean_values(num_values, 0.0);
+
+  for (unsigned rank = 0; rank < num_procs; ++rank) {
+    for (unsigned j = 0; j < num_values; ++j) {
+      max_values[j] = std::max(max_values[j], values[num_values*rank + j]);
+      mean_values[j] += values[num_values*rank + j] / num_procs;
+    }
+  }
+
+  std::vector<double> imbalances(num_values, 1.0);
+
+  for (unsigned j = 0; j < num_values; ++j) {
+    if (mean_values[j] > 0.0) {
+      imbalances[j] = max_values[j] / mean_values[j];
+    }
+  }
+
+  pManifest->SetNumber("cell_imbalance", imbalances[0]);
+  pManifest->SetNumber("rhs_imbalance", imbalances[1]);
+  pManifest->SetNumber("ode_imbalance", imbalances[4]);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::ofstream counters_file(file_path);
+  counters_file << "rank,cells,rhs_evaluations,cvode_steps,cell_time,ode_time"
+    << std::endl;
+
+  for (unsigned rank = 0; rank < num_procs; ++rank) {
+    const double* p_values = &values[num_values*rank];
+    counters_file << rank << "," << static_cast<unsigned>(p_values[0]) << ","
+      << static_cast<unsigned long>(p_values[1]) << ","
+      << static_cast<unsigned long>(p_values[2]) << "," << p_values[3] << ","
+      << p_values[4] << std::endl;
+  }
+  counters_file.close();
+
+  std::cout << "Load imbalance (max/mean over " << num_procs
+    << " processes): cells " << imbalances[0]
+    << ", RHS evaluations " << imbalances[1] << ", CVODE steps "
+    << imbalances[2] << ", ODE time " << imbalances[4] << std::endl;
+}
@@ -0,0 +1,215 @@
+#include "../../include/problem/UterineMemoryReport.hpp"
+
+#include <iomanip>
+#include <sys/resource.h>
+
+UterineMemoryReport::UterineMemoryReport(
+  const std::vector<AbstractCardiacCellInterface*>& rCells) :
+  mMeshBytes(0),
+  mMatrixBytes(0),
+  mVectorBytes(0) {
+  for (AbstractCardiacCellInterface* p_interface : rCells) {
+    AbstractCvodeCell* p_cell = dynamic_cast<AbstractCvodeCell*>(p_interface);
+
+    if (p_cell == NULL) {
+      continue;
+    }
+
+    // Cells of the same model have the same sizes
+    UterineCellModelMemory& r_model = mModels[p_cell->GetSystemName()];
+    const AbstractUterineCompactCell* p_shared =
+      dynamic_cast<const AbstractUterineCompactCell*>(p_interface);
+
+    if (r_model.numCells == 0) {
+      const unsigned long num_states = p_cell->GetNumberOfStateVariables();
+      const bool float_state = p_shared != NULL && p_shared->HasFloatState();
+      r_model.stateBytes = num_states *
+        (float_state ? sizeof(float) : sizeof(double));
+      r_model.parameterBytes = p_cell->GetNumberOfParameters() *
+        sizeof(double);
+      // The CVODE memory is allocated by the first solve: the BDF history
+      // of the maximum order 5, its work vectors and the last solution
+      // (13 vectors), and the dense Jacobian, its saved copy and pivots
+      r_model.cvodeBytes = 13 * num_states * sizeof(double) +
+        2 * num_states * num_states * sizeof(double) +
+        num_states * sizeof(long);
+    }
+    ++r_model.numCells;
+
+    if (p_shared != NULL && p_shared->HasSharedParameters()) {
+      ++r_model.numSharedCells;
+    }
+  }
+}
+
+
+void UterineMemoryReport::SetMeshBytes(unsigned long meshBytes) {
+  mMeshBytes = meshBytes;
+}
+
+
+void UterineMemoryReport::SetLinearSystem(unsigned numOwnedRows,
+                                          unsigned long numNonZeros,
+                                          unsigned numGlobalRows) {
+  // The matrices and vectors are created by Solve, these are their sizes
+  // once assembled. AIJ storage of the system and mass matrices.
+  mMatrixBytes = 2 * (numNonZeros * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+    (numOwnedRows + 1) * sizeof(PetscInt));
+  // Solution, right-hand side and 3 work vectors of the solver, and the
+  // replicated ionic and stimulus current caches of the tissue
+  mVectorBytes = (5 * numOwnedRows + 2 * numGlobalRows) * sizeof(double);
+}
+
+
+std::string UterineMemoryReport::FormatMb(double bytes) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(1) << bytes / (1024 * 1024)
+    << " MB";
+  return stream.str();
+}
+
+
+void UterineMemoryReport::Write(const std::string& log_path,
+                                UterineRunManifest* pManifest) {
+  // Cells, cell bytes, mesh, matrices, vectors and peak RSS of each process
+  const unsigned num_values = 6;
+  double local_values[num_values] = {0.0, 0.0,
+    static_cast<double>(mMeshBytes), static_cast<double>(mMatrixBytes),
+    static_cast<double>(mVectorBytes), GetPeakRss()};
+  std::ostringstream local_models;
+
+  for (const auto& [name, r_model] : mModels) {
+    local_values[0] += r_model.numCells;
+    // The shared parameter values are counted once per process
+    local_values[1] += static_cast<double>(r_model.numCells) *
+      (r_model.stateBytes + r_model.cvodeBytes) +
+      (r_model.numCells - r_model.numSharedCells +
+       (r_model.numSharedCells > 0 ? 1 : 0)) * r_model.parameterBytes;
+    local_models << name << " " << r_model.numCells << " "
+      << r_model.numSharedCells << " "
+      << r_model.stateBytes << " " << r_model.parameterBytes << " "
+      << r_model.cvodeBytes << std::endl;
+  }
+
+  const unsigned num_procs = PetscTools::GetNumProcs();
+  std::vector<double> values(num_values*num_procs);
+  MPI_Allgather(local_values, num_values, MPI_DOUBLE, values.data(),
+                num_values, MPI_DOUBLE, PETSC_COMM_WORLD);
+
+  // The models of the cells of each process, one per line
+  const std::string local_text = local_models.str();
+  const int local_size = local_text.size();
+  std::vector<int> sizes(num_procs);
+  MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0,
+             PETSC_COMM_WORLD);
+
+  std::vector<int> offsets(num_procs, 0);
+
+  for (unsigned i = 1; i < num_procs; ++i) {
+    offsets[i] = offsets[i - 1] + sizes[i - 1];
+  }
+
+  std::vector<char> text(offsets.back() + sizes.back() + 1, '\0');
+  MPI_Gatherv(local_text.data(), local_size, MPI_CHAR, text.data(),
+              sizes.data(), offsets.data(), MPI_CHAR, 0, PETSC_COMM_WORLD);
+
+  std::vector<double> total_values(num_values, 0.0);
+
+  for (unsigned rank = 0; rank < num_procs; ++rank) {
+    for (unsigned j = 0; j < num_values; ++j) {
+      total_values[j] += values[num_values*rank + j];
+    }
+  }
+
+  // In MB, as the peak resident memory of the manifest
+  pManifest->SetNumber("cell_memory_mb", total_values[1] / (1024 * 1024));
+  pManifest->SetNumber("mesh_memory_mb", total_values[2] / (1024 * 1024));
+  pManifest->SetNumber("petsc_memory_mb",
+                       (total_values[3] + total_values[4]) / (1024 * 1024));
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::map<std::string, UterineCellModelMemory> models;
+  std::istringstream models_stream(text.data());
+  std::string name;
+  UterineCellModelMemory model;
+
+  while (models_stream >> name >> model.numCells >> model.numSharedCells >>
+         model.stateBytes >> model.parameterBytes >> model.cvodeBytes) {
+    const unsigned num_cells = models[name].numCells + model.numCells;
+    const unsigned num_shared_cells = models[name].numSharedCells +
+      model.numSharedCells;
+    models[name] = model;
+    models[name].numCells = num_cells;
+    models[name].numSharedCells = num_shared_cells;
+  }
+
+  std::ostringstream report;
+  report << "Memory after initialisation" << std::endl;
+
+  for (const auto& [model_name, r_model] : models) {
+    report << "  " << model_name << ": " << r_model.numCells << " cells, "
+      << r_model.stateBytes + r_model.parameterBytes + r_model.cvodeBytes
+      << " bytes per cell (state " << r_model.stateBytes << ", parameters "
+      << r_model.parameterBytes << ", CVODE " << r_model.cvodeBytes << "), "
+      << r_model.numSharedCells << " cells sharing their parameters"
+      << std::endl;
+  }
+
+  for (unsigned rank = 0; rank < num_procs; ++rank) {
+    const double* p_values = &values[num_values*rank];
+    report << "  rank " << rank << ": "
+      << static_cast<unsigned>(p_values[0]) << " cells ("
+      << FormatMb(p_values[1]) << "), mesh " << FormatMb(p_values[2])
+      << ", matrices " << FormatMb(p_values[3]) << ", vectors "
+      << FormatMb(p_values[4]) << ", peak RSS " << FormatMb(p_values[5])
+      << std::endl;
+  }
+
+  report << "  total: " << static_cast<unsigned>(total_values[0])
+    << " cells (" << FormatMb(total_values[1]) << "), mesh "
+    << FormatMb(total_values[2]) << ", matrices " << FormatMb(total_values[3])
+    << ", vectors " << FormatMb(total_values[4]) << std::endl;
+
+  std::cout << report.str();
+
+  std::ofstream log_stream;
+  log_stream.open(log_path, std::ios::app);
+  log_stream << report.str();
+  log_stream.close();
+}
+
+
+double UterineMemoryReport::GetPeakRss() {
+  // Maximum resident set size of this process so far (bytes), in kB on Linux
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<double>(usage.ru_maxrss) * 1024;
+}
+
+
+void UterineMemoryReport::WritePeakRss(const std::string& log_path) {
+  const double local_rss = GetPeakRss();
+  double max_rss = 0.0;
+  double total_rss = 0.0;
+  MPI_Reduce(&local_rss, &max_rss, 1, MPI_DOUBLE, MPI_MAX, 0,
+             PETSC_COMM_WORLD);
+  MPI_Reduce(&local_rss, &total_rss, 1, MPI_DOUBLE, MPI_SUM, 0,
+             PETSC_COMM_WORLD);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::ostringstream report;
+  report << "Peak RSS: " << FormatMb(max_rss) << " on the largest process, "
+    << FormatMb(total_rss) << " in total" << std::endl;
+  std::cout << report.str();
+
+  std::ofstream log_stream;
+  log_stream.open(log_path, std::ios::app);
+  log_stream << report.str();
+  log_stream.close();
+}
@@ -0,0 +1,5 @@
+#include "../../include/problem/UterineMonodomainProblem.hpp"
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(UterineMonodomainProblem)
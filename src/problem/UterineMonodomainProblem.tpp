@@ -0,0 +1,46 @@
+#include "../../include/problem/UterineMonodomainProblem.hpp"
+
+template <unsigned DIM>
+UterineMonodomainProblem<DIM>::UterineMonodomainProblem(
+  AbstractCardiacCellFactory<DIM>* pCellFactory) :
+  MonodomainProblem<DIM>(pCellFactory) {
+}
+
+
+template <unsigned DIM>
+UterineMonodomainProblem<DIM>::UterineMonodomainProblem() :
+  MonodomainProblem<DIM>() {
+}
+
+
+template <unsigned DIM>
+void UterineMonodomainProblem<DIM>::SetCurrentTime(double time) {
+  // Only valid before the first solve, the initial condition is then
+  // created from the cell states
+  this->mCurrentTime = time;
+}
+
+
+template <unsigned DIM>
+void UterineMonodomainProblem<DIM>::Restart(double time) {
+  // Solve again from the given time, the new initial condition is created
+  // from the current cell states and the results are written in new files
+  if (this->mSolution) {
+    PetscTools::Destroy(this->mSolution);
+    this->mSolution = NULL;
+  }
+  this->mCurrentTime = time;
+}
+
+
+template <unsigned DIM>
+bool UterineMonodomainProblem<DIM>::GetPrintOutput() {
+  return this->mPrintOutput;
+}
+
+
+template <unsigned DIM>
+AbstractCardiacCellFactory<DIM>* UterineMonodomainProblem<DIM>::GetCellFactory() {
+  // NULL for a problem loaded from an archive
+  return this->mpCellFactory;
+}
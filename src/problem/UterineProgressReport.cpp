@@ -0,0 +1,198 @@
+#include "../../include/problem/UterineProgressReport.hpp"
+
+UterineProgressReport::UterineProgressReport(const std::string& rStatusPath,
+                                             double endTime,
+                                             double pdeTimestep,
+                                             unsigned numNodes,
+                                             double threshold,
+                                             double linePeriod,
+                                             unsigned statusSteps) :
+  AbstractOutputModifier(rStatusPath),
+  mStatusPath(rStatusPath),
+  mEndTime(endTime),
+  mPdeTimestep(pdeTimestep),
+  mNumNodes(numNodes),
+  mThreshold(threshold),
+  mLinePeriod(linePeriod),
+  mStatusSteps(statusSteps),
+  mStart(std::chrono::steady_clock::now()),
+  mRunStart(mStart),
+  mRunStartTime(0.0),
+  mTime(0.0),
+  mLastLine(0.0),
+  mNumRuns(0),
+  mNumSteps(0),
+  mActiveFraction(0.0) {
+}
+
+
+void UterineProgressReport::InitialiseAtStart(
+  DistributedVectorFactory* pVectorFactory) {
+}
+
+
+void UterineProgressReport::FinaliseAtEnd() {
+  // End of each solve, including the last chunk of an early stop
+  if (mNumRuns > 0 && mStatusSteps > 0) {
+    WriteStatus();
+  }
+}
+
+
+void UterineProgressReport::ProcessSolutionAtTimeStep(
+  double time, Vec solution, unsigned problemDim) {
+  // Times within a fraction of a time step are the same printing time
+  const double tolerance = 1e-3 * mPdeTimestep;
+
+  if (mNumRuns == 0 || time < mTime - tolerance) {
+    ++mNumRuns;
+    mRunStart = std::chrono::steady_clock::now();
+    mRunStartTime = time;
+    mNumSteps = 0;
+  } else if (time < mTime + tolerance) {
+    return;  // Start of the next chunk of a solve, already reported
+  } else {
+    ++mNumSteps;
+  }
+  mTime = time;
+
+  // The voltage is the first of the problemDim values of each node
+  const double* p_values;
+  PetscInt num_local_values;
+  VecGetArrayRead(solution, &p_values);
+  VecGetLocalSize(solution, &num_local_values);
+  unsigned local_active = 0;
+
+  for (PetscInt i = 0; i < num_local_values; i += problemDim) {
+    if (p_values[i] >= mThreshold) {
+      ++local_active;
+    }
+  }
+  VecRestoreArrayRead(solution, &p_values);
+
+  unsigned num_active = 0;
+  MPI_Allreduce(&local_active, &num_active, 1, MPI_UNSIGNED, MPI_SUM,
+                PETSC_COMM_WORLD);
+  mActiveFraction = mNumNodes == 0 ? 0.0 :
+    static_cast<double>(num_active) / mNumNodes;
+
+  // The end of the run is always reported
+  const bool run_end = time > mEndTime - tolerance;
+  const double wall_time = GetWallTime(mStart);
+
+  if (mLinePeriod > 0.0 &&
+      (wall_time - mLastLine >= mLinePeriod || run_end)) {
+    WriteLine();
+    mLastLine = wall_time;
+  }
+
+  if (mStatusSteps > 0 && (mNumSteps % mStatusSteps == 0 || run_end)) {
+    WriteStatus();
+  }
+}
+
+
+double UterineProgressReport::GetWallTime(
+  std::chrono::steady_clock::time_point start) const {
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+
+std::string UterineProgressReport::FormatDuration(double seconds) {
+  if (seconds < 0.0) {
+    return "--:--:--";  // Not known yet
+  }
+
+  const unsigned long total = static_cast<unsigned long>(seconds + 0.5);
+  std::ostringstream duration_stream;
+  duration_stream << std::setfill('0') << std::setw(2) << total / 3600 << ":"
+    << std::setw(2) << total / 60 % 60 << ":" << std::setw(2) << total % 60;
+  return duration_stream.str();
+}
+
+
+void UterineProgressReport::WriteLine() const {
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::ostringstream line_stream;
+  line_stream << "Progress: ";
+
+  if (mNumRuns > 1) {
+    line_stream << "run " << mNumRuns << ", ";
+  }
+  line_stream << std::fixed << std::setprecision(1) << mTime << "/"
+    << mEndTime << " ms (" << 100.0 * mTime / mEndTime << "%), wall "
+    << FormatDuration(GetWallTime(mStart)) << ", "
+    << std::scientific << std::setprecision(2) << GetNodeStepsPerSecond()
+    << " node-steps/s, ETA " << FormatDuration(GetRemainingTime()) << ", "
+    << std::fixed << std::setprecision(1) << 100.0 * mActiveFraction
+    << "% active";
+  std::cout << line_stream.str() << std::endl;
+}
+
+
+void UterineProgressReport::WriteStatus() const {
+  if (!PetscTools::AmMaster() || mStatusPath.empty()) {
+    return;
+  }
+
+  const double remaining_time = GetRemainingTime();
+
+  // Written next to the status file and renamed, so that readers never see
+  // a partial file
+  const std::string tmp_path = mStatusPath + ".tmp" +
+    std::to_string(getpid());
+  std::ofstream status_file(tmp_path);
+  status_file << "{\n";
+  status_file << "  \"run\": " << mNumRuns << ",\n";
+  status_file << "  \"time\": " << json_number(mTime) << ",\n";
+  status_file << "  \"end_time\": " << json_number(mEndTime) << ",\n";
+  status_file << "  \"wall_time\": " << json_number(GetWallTime(mStart))
+    << ",\n";
+  status_file << "  \"node_steps_per_second\": "
+    << json_number(GetNodeStepsPerSecond()) << ",\n";
+  status_file << "  \"remaining_time\": "
+    << (remaining_time < 0.0 ? "null" : json_number(remaining_time)) << ",\n";
+  status_file << "  \"active_fraction\": " << json_number(mActiveFraction)
+    << ",\n";
+  status_file << "  \"updated\": " << std::time(NULL) << "\n";
+  status_file << "}" << std::endl;
+  status_file.close();
+  std::rename(tmp_path.c_str(), mStatusPath.c_str());
+}
+
+
+unsigned UterineProgressReport::GetNumRuns() const {
+  return mNumRuns;
+}
+
+
+double UterineProgressReport::GetActiveFraction() const {
+  return mActiveFraction;
+}
+
+
+double UterineProgressReport::GetNodeStepsPerSecond() const {
+  // Since the start of the run, the set up of the problem is not counted
+  const double wall_time = GetWallTime(mRunStart);
+
+  if (wall_time <= 0.0) {
+    return 0.0;
+  }
+  return mNumNodes * (mTime - mRunStartTime) / mPdeTimestep / wall_time;
+}
+
+
+double UterineProgressReport::GetRemainingTime() const {
+  // Wall time to the end of the run at the rate of the run so far, -1 before
+  // the first step
+  const double done = mTime - mRunStartTime;
+
+  if (done <= 0.0) {
+    return -1.0;
+  }
+  return std::max(0.0, GetWallTime(mRunStart) * (mEndTime - mTime) / done);
+}
@@ -1,6 +1,543 @@
 #include "../include/simulation.hpp"
 
-void run_simulation(const int dim) {
+template <unsigned DIM>
+void save_checkpoint(UterineMonodomainProblem<DIM>& problem,
+                     UterineConductivityModifier* modifier,
+                     std::string archive_dir) {
+  // Save the tissue, cells and stimuli
+  CardiacSimulationArchiver<UterineMonodomainProblem<DIM>>::Save(
+    problem, archive_dir, false);
+  // The conductivity modifier is not archived with the tissue
+  if (modifier != NULL) {
+    save_modifier(modifier, archive_dir);
+  }
+
+  std::cout << "Checkpoint at " << problem.GetCurrentTime() << " ms saved in "
+    << archive_dir << std::endl;
+}
+
+
+bool stimulus_pending(const SimulationSettings& settings, double time,
+                      double end_time) {
+  if (settings.stimulus_type == "zero") {
+    return false;
+  } else if (time < settings.stimulus_start) {
+    return settings.stimulus_start < end_time;
+  } else if (settings.stimulus_type == "simple") {
+    return time < settings.stimulus_start + settings.stimulus_duration;
+  }
+
+  // Regular and region stimuli repeat every period
+  const double last_onset = settings.stimulus_start + settings.stimulus_period *
+    std::floor((time - settings.stimulus_start) / settings.stimulus_period);
+
+  return time < last_onset + settings.stimulus_duration ||
+    last_onset + settings.stimulus_period < end_time;
+}
+
+
+template <unsigned DIM>
+bool tissue_at_rest(UterineMonodomainProblem<DIM>& problem,
+                    const SimulationSettings& settings, double end_time) {
+  if (stimulus_pending(settings, problem.GetCurrentTime(), end_time)) {
+    return false;
+  }
+
+  // Highest voltage over all the processes
+  double max_voltage;
+  VecMax(problem.GetSolution(), NULL, &max_voltage);
+  return max_voltage < settings.rest_threshold;
+}
+
+
+template <unsigned DIM>
+void solve_with_checkpoints(UterineMonodomainProblem<DIM>& problem,
+                            UterineConductivityModifier* modifier,
+                            const SimulationSettings& settings) {
+  const bool checkpoint = HeartConfig::Instance()->GetCheckpointSimulation();
+  const bool early_stop = settings.rest_check_interval > 0.0;
+
+  if (!checkpoint && !early_stop) {
+    problem.Solve();
+    return;
+  }
+
+  const double sim_duration = HeartConfig::Instance()->GetSimulationDuration();
+
+  // Only keep the most recent checkpoints on disk
+  std::unique_ptr<OutputDirectoryFifoQueue> p_directory_queue;
+
+  if (checkpoint) {
+    p_directory_queue.reset(new OutputDirectoryFifoQueue(
+      HeartConfig::Instance()->GetOutputDirectory() + "_checkpoints/",
+      HeartConfig::Instance()->GetMaxCheckpointsOnDisk()));
+  }
+
+  // A stepper that is not used goes to the end in one step
+  TimeStepper checkpoint_stepper(problem.GetCurrentTime(), sim_duration,
+    checkpoint ? HeartConfig::Instance()->GetCheckpointTimestep() :
+    sim_duration);
+  TimeStepper rest_stepper(problem.GetCurrentTime(), sim_duration,
+    early_stop ? settings.rest_check_interval : sim_duration);
+  // Times within a fraction of a time step are the same, the two steppers
+  // round differently
+  const double tolerance = 1e-3 * HeartConfig::Instance()->GetPdeTimeStep();
+
+  while (!checkpoint_stepper.IsTimeAtEnd()) {
+    // Solve up to the next checkpoint or rest check
+    const double next_time = std::min(checkpoint_stepper.GetNextTime(),
+                                      rest_stepper.GetNextTime());
+    HeartConfig::Instance()->SetSimulationDuration(next_time);
+    problem.Solve();
+
+    if (checkpoint_stepper.GetNextTime() < next_time + tolerance) {
+      if (checkpoint) {
+        std::stringstream checkpoint_id;
+        checkpoint_id << next_time << "ms/";
+        std::string checkpoint_dir = p_directory_queue->CreateNextDir(
+          checkpoint_id.str());
+
+        save_checkpoint(problem, modifier, checkpoint_dir + "archive");
+      }
+      checkpoint_stepper.AdvanceOneTimeStep();
+    }
+
+    if (rest_stepper.GetNextTime() < next_time + tolerance) {
+      rest_stepper.AdvanceOneTimeStep();
+
+      if (early_stop && next_time < sim_duration - tolerance &&
+          tissue_at_rest(problem, settings, sim_duration)) {
+        // Nothing happens until the end, the results stop here
+        std::cout << "Tissue at rest with no pending stimulus, stopping at "
+          << next_time << " ms" << std::endl;
+        settings.manifest->SetEntry("stopped_early", "true");
+        settings.manifest->SetNumber("early_stop_time", next_time);
+        break;
+      }
+    }
+  }
+
+  // Following solves of Monte Carlo runs use the full duration
+  HeartConfig::Instance()->SetSimulationDuration(sim_duration);
+}
+
+
+template <unsigned DIM>
+UterineMonodomainProblem<DIM>* load_checkpoint(std::string archive_dir) {
+  // Loading the archive overwrites the HeartConfig, keep the requested values
+  const double sim_duration = HeartConfig::Instance()->GetSimulationDuration();
+  const bool checkpoint = HeartConfig::Instance()->GetCheckpointSimulation();
+  double checkpoint_timestep = -1.0;
+  unsigned max_checkpoints = UINT_MAX;
+
+  if (checkpoint) {
+    checkpoint_timestep = HeartConfig::Instance()->GetCheckpointTimestep();
+    max_checkpoints = HeartConfig::Instance()->GetMaxCheckpointsOnDisk();
+  }
+
+  UterineMonodomainProblem<DIM>* problem =
+    CardiacSimulationArchiver<UterineMonodomainProblem<DIM>>::Load(
+      archive_dir);
+
+  HeartConfig::Instance()->SetSimulationDuration(sim_duration);
+  HeartConfig::Instance()->SetCheckpointSimulation(checkpoint,
+                                                   checkpoint_timestep,
+                                                   max_checkpoints);
+
+  std::cout << "Resuming from " << archive_dir << " at "
+    << problem->GetCurrentTime() << " ms" << std::endl;
+  return problem;
+}
+
+
+template <int DIM>
+AbstractUterineCellFactoryTemplate<DIM>* create_cell_factory(
+  const std::string& stimulus_type) {
+  if (stimulus_type == "simple") {
+    return new UterineSimpleCellFactory<DIM>();
+  } else if (stimulus_type == "regular") {
+    return new UterineRegularCellFactory<DIM>();
+  } else if (stimulus_type == "region") {
+    return new UterineRegionCellFactory<DIM>();
+  } else if (stimulus_type == "zero") {
+    return new UterineZeroCellFactory<DIM>();
+  }
+
+  const std::string err_message = "Unrecognized stimulus type";
+  const std::string err_filename = "simulation.cpp";
+  unsigned line_number = 165;
+
+  throw Exception(err_message, err_filename, line_number);
+}
+
+
+template <unsigned DIM>
+std::string partition_mesh(const std::string& mesh_path,
+                           const toml::value& sys_params, bool orthotropic,
+                           std::string& rWeightsKey) {
+  // Balance the expected cost of the nodes rather than their number
+  const std::string weights_source = toml::find_or<std::string>(sys_params,
+    "partition_weights", "none");
+  std::unique_ptr<UterinePartitionWeights<DIM>> p_weights;
+
+  if (weights_source == "cost_map") {
+    std::string cost_map_path = toml::find<std::string>(sys_params,
+                                                        "partition_cost_map");
+
+    if (cost_map_path[0] != '/') {
+      cost_map_path = OutputFileHandler::GetChasteTestOutputDirectory() +
+        cost_map_path;
+    }
+
+    p_weights.reset(new UterinePartitionWeights<DIM>(mesh_path));
+    p_weights->ReadCostMap(cost_map_path);
+  } else if (weights_source == "regions") {
+    std::unique_ptr<AbstractUterineCellFactoryTemplate<DIM>> p_factory(
+      create_cell_factory<DIM>(toml::find<std::string>(sys_params,
+                                                       "stimulus_type")));
+    p_weights.reset(new UterinePartitionWeights<DIM>(mesh_path));
+    p_weights->SetRegionCosts(p_factory.get(),
+      toml::find<std::vector<double>>(sys_params, "region_costs"));
+  } else if (weights_source != "none") {
+    const std::string err_message = "Unrecognized partition weights " +
+      weights_source;
+    const std::string err_filename = "simulation.cpp";
+    unsigned line_number = 202;
+
+    throw Exception(err_message, err_filename, line_number);
+  }
+
+  rWeightsKey = p_weights ? p_weights->GetKey() : "";
+  UterineMeshPartitionCache<DIM> cache(mesh_path, rWeightsKey);
+
+  if (p_weights) {
+    cache.SetNodeWeights(p_weights->rGetWeights());
+  }
+  return cache.GetMeshPath(orthotropic);
+}
+
+
+template <unsigned DIM>
+void set_up_mesh(UterineMonodomainProblem<DIM>& problem,
+                 DistributedTetrahedralMesh<DIM, DIM>& mesh,
+                 const SimulationSettings& settings) {
+  if (settings.reuse_mesh) {
+    // Keep the mesh in memory for the next simulations
+    problem.SetMesh(UterineSharedMesh<DIM>::Get(settings.mesh_path,
+      settings.partition_source, settings.partition_weights_key));
+  } else if (!settings.partition_source.empty()) {
+    UterineMeshPartitionCache<DIM> cache(settings.partition_source,
+                                         settings.partition_weights_key);
+    cache.ConstructMesh(mesh);
+    problem.SetMesh(&mesh);
+  }  // Otherwise the problem reads and partitions the mesh itself
+}
+
+
+template <unsigned DIM>
+void record_mesh_size(UterineMonodomainProblem<DIM>& problem,
+                      const SimulationSettings& settings) {
+  settings.manifest->SetMeshSize(problem.rGetMesh().GetNumNodes(),
+                                 problem.rGetMesh().GetNumElements());
+}
+
+
+template <unsigned DIM>
+void report_memory(UterineMonodomainProblem<DIM>& problem,
+                   const SimulationSettings& settings) {
+  if (!settings.memory_report) {
+    return;
+  }
+
+  AbstractTetrahedralMesh<DIM, DIM>& r_mesh = problem.rGetMesh();
+  UterineMemoryReport report(problem.GetTissue()->rGetCellsDistributed());
+
+  // Entry of the containing element sets of the nodes: a tree node of 3
+  // pointers and a colour, and the element index
+  const unsigned long set_entry_bytes = 4 * sizeof(void*) + sizeof(unsigned);
+  unsigned long mesh_bytes = 0;
+  unsigned long num_non_zeros = 0;
+
+  for (auto iter = r_mesh.GetNodeIteratorBegin();
+       iter != r_mesh.GetNodeIteratorEnd(); ++iter) {
+    mesh_bytes += sizeof(Node<DIM>) +
+      iter->GetNumContainingElements() * set_entry_bytes;
+
+    // The row of the node in the system matrix has the nodes of its elements
+    std::set<unsigned> columns;
+
+    for (auto element_iter = iter->ContainingElementsBegin();
+         element_iter != iter->ContainingElementsEnd(); ++element_iter) {
+      Element<DIM, DIM>* p_element = r_mesh.GetElement(*element_iter);
+
+      for (unsigned i = 0; i < p_element->GetNumNodes(); ++i) {
+        columns.insert(p_element->GetNodeGlobalIndex(i));
+      }
+    }
+    num_non_zeros += columns.size();
+  }
+
+  DistributedTetrahedralMesh<DIM, DIM>* p_distributed_mesh =
+    dynamic_cast<DistributedTetrahedralMesh<DIM, DIM>*>(&r_mesh);
+
+  if (p_distributed_mesh != NULL) {
+    std::vector<unsigned> halo_indices;
+    p_distributed_mesh->GetHaloNodeIndices(halo_indices);
+    mesh_bytes += halo_indices.size() * sizeof(Node<DIM>);
+  }
+
+  mesh_bytes += r_mesh.GetNumLocalElements() *
+    (sizeof(Element<DIM, DIM>) + (DIM + 1) * sizeof(Node<DIM>*));
+  mesh_bytes += r_mesh.GetNumLocalBoundaryElements() *
+    (sizeof(BoundaryElement<DIM - 1, DIM>) + DIM * sizeof(Node<DIM>*));
+
+  report.SetMeshBytes(mesh_bytes);
+  report.SetLinearSystem(
+    r_mesh.GetDistributedVectorFactory()->GetLocalOwnership(), num_non_zeros,
+    r_mesh.GetNumNodes());
+  report.Write(settings.log_path, settings.manifest);
+}
+
+
+template <unsigned DIM>
+void report_progress(UterineMonodomainProblem<DIM>& problem,
+                     const SimulationSettings& settings) {
+  if (settings.progress_interval <= 0.0 && settings.status_steps == 0) {
+    return;
+  }
+
+  // The status file stays in the results folder of the simulation,
+  // realisations included
+  std::string status_path = "";
+
+  if (settings.status_steps > 0) {
+    OutputFileHandler results_handler(
+      HeartConfig::Instance()->GetOutputDirectory(), false);
+    status_path = results_handler.GetOutputDirectoryFullPath() +
+      "status.json";
+  }
+
+  boost::shared_ptr<UterineProgressReport> p_progress(
+    new UterineProgressReport(status_path,
+      HeartConfig::Instance()->GetSimulationDuration(),
+      HeartConfig::Instance()->GetPdeTimeStep(),
+      problem.rGetMesh().GetNumNodes(), settings.activation_threshold,
+      settings.progress_interval, settings.status_steps));
+  problem.AddOutputModifier(p_progress);
+}
+
+
+template <unsigned DIM>
+void warm_start(UterineMonodomainProblem<DIM>& problem,
+                const SimulationSettings& settings) {
+  if (settings.warm_start_key.empty()) {
+    return;
+  }
+
+  UterineWarmStartCache<DIM> cache(settings.warm_start_key);
+  std::ofstream log_stream;
+  log_stream.open(settings.log_path, ios::app);
+  log_stream << "Warm start" << std::endl;
+  log_stream << "  key: " << cache.GetKey() << std::endl;
+
+  if (cache.IsAvailable()) {
+    // Start from the cached state at the stimulus onset
+    cache.Load(problem);
+    problem.SetCurrentTime(cache.GetTime());
+
+    std::cout << "Warm start cache hit, starting at " << cache.GetTime()
+      << " ms" << std::endl;
+    log_stream << "  cache: hit" << std::endl;
+  } else {
+    // Solve up to the stimulus onset and save the state for the next runs
+    const double sim_duration =
+      HeartConfig::Instance()->GetSimulationDuration();
+    const bool print_output = problem.GetPrintOutput();
+
+    std::cout << "Warm start cache miss, solving up to "
+      << settings.warm_start_time << " ms" << std::endl;
+    HeartConfig::Instance()->SetSimulationDuration(settings.warm_start_time);
+    problem.PrintOutput(false);
+    problem.Solve();
+    cache.Save(problem);
+    HeartConfig::Instance()->SetSimulationDuration(sim_duration);
+
+    // The results start at the stimulus onset as with a cache hit, so that
+    // they do not depend on the state of the cache
+    problem.PrintOutput(print_output);
+    problem.Restart(settings.warm_start_time);
+
+    log_stream << "  cache: miss" << std::endl;
+  }
+  log_stream << "  start time: " << settings.warm_start_time << " ms"
+    << std::endl;
+  log_stream.close();
+}
+
+
+template <unsigned DIM>
+void solve_monte_carlo(UterineMonodomainProblem<DIM>& problem,
+                       UterineConductivityModifier* modifier,
+                       const SimulationSettings& settings) {
+  UterineRegionCellFactory<DIM>* p_factory =
+    dynamic_cast<UterineRegionCellFactory<DIM>*>(problem.GetCellFactory());
+
+  if (p_factory == NULL) {
+    const std::string err_msg = "Monte Carlo runs need the region stimulus";
+    const std::string err_filename = "simulation.cpp";
+    unsigned line_number = 385;
+
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  AbstractTetrahedralMesh<DIM, DIM>& r_mesh = problem.rGetMesh();
+  DistributedVectorFactory* p_vector_factory =
+    r_mesh.GetDistributedVectorFactory();
+
+  // Only the activation statistics are kept, not the full fields
+  boost::shared_ptr<UterineActivationStatistics> p_statistics(
+    new UterineActivationStatistics("activation_stats.csv",
+                                    settings.activation_threshold));
+  problem.AddOutputModifier(p_statistics);
+  problem.PrintOutput(false);
+
+  OutputFileHandler results_handler(
+    HeartConfig::Instance()->GetOutputDirectory(), false);
+  const std::string stats_path =
+    results_handler.GetOutputDirectoryFullPath() + "activation_stats.csv";
+  std::ofstream realisations_file;
+
+  if (PetscTools::AmMaster()) {
+    realisations_file.open(results_handler.GetOutputDirectoryFullPath() +
+                           "realisations.csv");
+    realisations_file << "realisation,activated_fraction" << std::endl;
+  }
+
+  std::ofstream log_stream;
+  log_stream.open(settings.log_path, ios::app);
+  log_stream << "Monte Carlo" << std::endl;
+  log_stream << "  realisations: " << settings.monte_carlo_runs << std::endl;
+  log_stream << "  region seed: " << settings.region_seed << std::endl;
+  log_stream << "  activation threshold: " << settings.activation_threshold
+    << " mV" << std::endl;
+  log_stream.close();
+
+  warm_start(problem, settings);
+
+  for (unsigned realisation = 0; realisation < settings.monte_carlo_runs;
+       ++realisation) {
+    if (realisation > 0) {
+      // The tissue, the cells and the solver are kept, only the cell
+      // states change between realisations
+      for (unsigned index = p_vector_factory->GetLow();
+           index < p_vector_factory->GetHigh();
+           ++index) {
+        AbstractCvodeCell* p_cell = dynamic_cast<AbstractCvodeCell*>(
+          problem.GetTissue()->GetCardiacCell(index));
+        AbstractUterineCompactCell::ExpandCellState(p_cell);
+        p_cell->ResetToInitialConditions();
+        p_cell->ResetSolver();
+      }
+      problem.Restart();
+
+      if (!settings.warm_start_key.empty()) {
+        // The state at the stimulus onset does not depend on the seed
+        UterineWarmStartCache<DIM>(settings.warm_start_key).Load(problem);
+        problem.SetCurrentTime(settings.warm_start_time);
+      }
+    }
+
+    // Every process draws the same regions from the realisation stream
+    p_factory->GetSelector()->SetStream(settings.region_seed, realisation);
+    p_statistics->StartRealisation();
+
+    std::cout << "Monte Carlo realisation " << realisation + 1 << "/"
+      << settings.monte_carlo_runs << std::endl;
+    solve_with_checkpoints(problem, modifier, settings);
+
+    // Update the statistics on disk so that partial runs are usable
+    const double activated_fraction = p_statistics->EndRealisation();
+    p_statistics->WriteStatistics(stats_path, r_mesh.rGetNodePermutation());
+
+    if (PetscTools::AmMaster()) {
+      realisations_file << realisation << "," << activated_fraction
+        << std::endl;
+    }
+  }
+
+  settings.manifest->SetNumber("monte_carlo_runs", settings.monte_carlo_runs);
+  settings.manifest->SetNumber("region_seed", settings.region_seed);
+}
+
+
+template <unsigned DIM>
+void write_cell_costs(UterineMonodomainProblem<DIM>& problem,
+                      const SimulationSettings& settings) {
+  // The event handler time is in ms
+  UterineCellCosts costs(problem.GetTissue()->rGetCellsDistributed(),
+    problem.rGetMesh().GetDistributedVectorFactory()->GetLow(),
+    HeartEventHandler::GetElapsedTime(HeartEventHandler::SOLVE_ODES)/1000);
+  OutputFileHandler results_handler(
+    HeartConfig::Instance()->GetOutputDirectory(), false);
+
+  costs.WriteCostMap(
+    results_handler.GetOutputDirectoryFullPath() + "cell_costs.csv",
+    problem.rGetMesh().rGetNodePermutation());
+  costs.WriteRankCounters(
+    results_handler.GetOutputDirectoryFullPath() + "rank_costs.csv",
+    settings.manifest);
+
+  if (PetscTools::ReplicateBool(costs.GetNumProfiled() <
+      problem.GetTissue()->rGetCellsDistributed().size())) {
+    std::cout << "Some cells are not profiled, their costs are 0"
+      << std::endl;
+  }
+}
+
+
+template <unsigned DIM>
+void solve_problem(UterineMonodomainProblem<DIM>& problem,
+                   UterineConductivityModifier* modifier,
+                   const SimulationSettings& settings) {
+  if (settings.monte_carlo_runs > 0) {
+    solve_monte_carlo(problem, modifier, settings);
+  } else {
+    boost::shared_ptr<UterineActivationStatistics> p_statistics;
+
+    if (settings.activation_map) {
+      // Activation times of the single run, used to screen sweep points
+      p_statistics.reset(new UterineActivationStatistics(
+        "activation_stats.csv", settings.activation_threshold));
+      problem.AddOutputModifier(p_statistics);
+    }
+
+    warm_start(problem, settings);
+    solve_with_checkpoints(problem, modifier, settings);
+
+    if (p_statistics) {
+      OutputFileHandler results_handler(
+        HeartConfig::Instance()->GetOutputDirectory(), false);
+      p_statistics->EndRealisation();
+      p_statistics->WriteStatistics(
+        results_handler.GetOutputDirectoryFullPath() + "activation_stats.csv",
+        problem.rGetMesh().rGetNodePermutation());
+    }
+  }
+
+  if (settings.cell_profiling) {
+    write_cell_costs(problem, settings);
+  }
+}
+
+
+void run_simulation(const int dim, std::string resume_dir, bool reuse_mesh) {
+  const auto run_start = std::chrono::steady_clock::now();
+  HeartEventHandler::Reset();  // Only time this run
+  UterineEventHandler::Reset();
+  UterineConductivityModifier::ResetTimer();
+  UterineEventHandler::BeginEvent(UterineEventHandler::EVERYTHING);
+  HeartConfig::Reset();  // Drop the settings of a previous sweep point
+
   // Get parameters from config file
   std::string param_file = USMC_SYSTEM_CONSTANTS::CONFIG_DIR;
 
@@ -10,7 +547,7 @@ void run_simulation(const int dim) {
     param_file += USMC_SYSTEM_CONSTANTS::GENERAL_3D_PARAM_FILE;
   }
 
-  const auto sys_params = toml::parse(param_file);
+  const auto sys_params = read_config(param_file, "general");
 
   // Time constants
   const double sim_duration = toml::find<double>(sys_params, "sim_duration");
@@ -20,6 +557,40 @@ void run_simulation(const int dim) {
     "print_timestep");
   const bool orthotropic = toml::find<bool>(sys_params, "orthotropic");
 
+  // Checkpoint parameters, a timestep of 0 disables checkpointing
+  const double checkpoint_timestep = toml::find_or<double>(sys_params,
+    "checkpoint_timestep", 0.0);
+  const unsigned max_checkpoints = toml::find_or<unsigned>(sys_params,
+    "max_checkpoints", 2);
+
+  // Reuse the pre-stimulus tissue state of previous runs
+  const bool use_warm_start = toml::find_or<bool>(sys_params, "warm_start",
+                                                  false);
+  // Convert the mesh to binary on first use
+  const bool use_mesh_cache = toml::find_or<bool>(sys_params, "mesh_cache",
+                                                  false);
+  // Reuse the mesh partition of previous runs with as many processes
+  const bool use_partition_cache = toml::find_or<bool>(sys_params,
+    "partition_cache", false);
+  // Balance the expected cost of the nodes between the processes
+  const bool use_partition_weights = toml::find_or<std::string>(sys_params,
+    "partition_weights", "none") != "none";
+  // Skip the runs whose results were already computed
+  const bool use_result_cache = toml::find_or<bool>(sys_params,
+    "result_cache", false);
+  // Stop when the tissue is at rest and no stimulus is left
+  const bool use_early_stop = toml::find_or<bool>(sys_params, "early_stop",
+                                                  false);
+  // Sample the call stacks of the simulation for flame graphs
+  const bool use_sampling_profiler = toml::find_or<bool>(sys_params,
+    "sampling_profiler", false);
+  // Realisations of the region stimulus, 0 for a single run
+  const unsigned monte_carlo_runs = toml::find_or<unsigned>(sys_params,
+    "monte_carlo_runs", 0);
+  // Merge the mesh nodes closer than this size, 0 to use the full mesh
+  const double coarsening = toml::find_or<double>(sys_params, "coarsening",
+                                                  0.0);
+
   const std::string mesh_dir = getenv("CHASTE_SOURCE_DIR") +
     toml::find<std::string>(sys_params, "mesh_dir");
   const std::string mesh_name = toml::find<std::string>(sys_params,
@@ -44,27 +615,134 @@ void run_simulation(const int dim) {
       "cell/" + cell_type + ".toml";
   }
 
-  const auto cell_params = toml::parse(cell_param_file);
+  const auto cell_params = read_config(cell_param_file, "cell");
   std::vector<double> conductivities;
 
+  // The mesh writers of the caches do not keep the node attributes, the
+  // labels of the non-excitable nodes would never match
+  if (toml::find_or<int>(sys_params, "passive_tissue_label", -1) >= 0 &&
+      (coarsening > 0.0 || use_mesh_cache ||
+       ((use_partition_cache || use_partition_weights) &&
+        resume_dir.empty()))) {
+    const std::string err_message = "passive_tissue_label needs the node "
+      "attributes of the source mesh, disable mesh_cache, coarsening, "
+      "partition_cache and partition_weights";
+    const std::string err_filename = "simulation.cpp";
+    unsigned line_number = 628;
+
+    throw Exception(err_message, err_filename, line_number);
+  }
+
+  // Load the mesh from the binary cache if requested
+  const auto mesh_cache_start = std::chrono::steady_clock::now();
+  std::string mesh_path = mesh_dir + mesh_name;
+
+  if (coarsening > 0.0 && dim == 2) {
+    mesh_path = UterineCoarseMesh<2>(mesh_path, coarsening).GetMeshPath(
+      orthotropic);
+  } else if (coarsening > 0.0 && dim == 3) {
+    mesh_path = UterineCoarseMesh<3>(mesh_path, coarsening).GetMeshPath(
+      orthotropic);
+  }
+
+  if (use_mesh_cache && dim == 2) {
+    mesh_path = UterineMeshCache<2>(mesh_path).GetMeshPath(orthotropic);
+  } else if (use_mesh_cache && dim == 3) {
+    mesh_path = UterineMeshCache<3>(mesh_path).GetMeshPath(orthotropic);
+  }
+
+  // A resumed simulation loads the mesh from the checkpoint. Weighted
+  // partitions go through the partition cache as well.
+  std::string partition_source = "";
+  std::string partition_weights_key = "";
+
+  if ((use_partition_cache || use_partition_weights) && resume_dir.empty()) {
+    partition_source = mesh_path;
+
+    if (dim == 2) {
+      mesh_path = partition_mesh<2>(partition_source, sys_params, orthotropic,
+                                    partition_weights_key);
+    } else if (dim == 3) {
+      mesh_path = partition_mesh<3>(partition_source, sys_params, orthotropic,
+                                    partition_weights_key);
+    }
+  }
+  const std::chrono::duration<double> mesh_cache_time =
+    std::chrono::steady_clock::now() - mesh_cache_start;
+
   // Cell parameters
   if (orthotropic) {
     // If orthotropic extract the correct conductivities
     conductivities = toml::find<std::vector<double>>(
       cell_params, "ortho_conductivities");
-    HeartConfig::Instance()->SetMeshFileName(mesh_dir + mesh_name,
+    HeartConfig::Instance()->SetMeshFileName(mesh_path,
                                              cp::media_type::Orthotropic);
   } else if (dim == 2) {  // If 2D extract x, y conductivities
     conductivities = toml::find<std::vector<double>>(
       cell_params, "conductivities_2d");
-    HeartConfig::Instance()->SetMeshFileName(mesh_dir + mesh_name);
+    HeartConfig::Instance()->SetMeshFileName(mesh_path);
   } else if (dim == 3) {  // If 3D extract x, y, z conductivities
     conductivities = toml::find<std::vector<double>>(
       cell_params, "conductivities_3d");
-    HeartConfig::Instance()->SetMeshFileName(mesh_dir + mesh_name);
+    HeartConfig::Instance()->SetMeshFileName(mesh_path);
   }
   const double capacitance = toml::find<double>(cell_params, "capacitance");
 
+  SimulationSettings settings;
+  settings.stimulus_type = stimulus_type;
+  settings.resume_dir = resume_dir;
+  settings.warm_start_key = "";
+  settings.warm_start_time = 0.0;
+  settings.partition_source = partition_source;
+  settings.partition_weights_key = partition_weights_key;
+  settings.mesh_path = mesh_path;
+  settings.reuse_mesh = reuse_mesh && resume_dir.empty();
+  settings.monte_carlo_runs = resume_dir.empty() ? monte_carlo_runs : 0;
+  settings.region_seed = toml::find_or<unsigned>(sys_params, "region_seed",
+                                                 982);
+  settings.activation_threshold = toml::find_or<double>(sys_params,
+    "activation_threshold", -40.0);
+  settings.cell_profiling = toml::find_or<bool>(sys_params, "cell_profiling",
+                                               false);
+  settings.activation_map = toml::find_or<bool>(sys_params, "activation_map",
+                                                false);
+  settings.memory_report = toml::find_or<bool>(sys_params, "memory_report",
+                                               false);
+  settings.progress_interval = toml::find_or<double>(sys_params,
+    "progress_interval", 0.0);
+  settings.status_steps = toml::find_or<unsigned>(sys_params, "status_steps",
+                                                  0);
+  settings.stimulus_start = toml::find<double>(cell_params, "start_time");
+  settings.stimulus_period = toml::find<double>(cell_params, "period");
+  settings.stimulus_duration = toml::find<double>(cell_params, "duration");
+  settings.rest_threshold = toml::find_or<double>(sys_params,
+    "rest_threshold", -40.0);
+  settings.rest_check_interval = 0.0;
+
+  if (use_early_stop) {
+    // Checked at printing times
+    settings.rest_check_interval = print_timestep * std::ceil(
+      toml::find_or<double>(sys_params, "rest_check_interval", 100.0) /
+      print_timestep);
+  }
+
+  UterineRunManifest manifest;
+  settings.manifest = &manifest;
+
+  if (use_warm_start && resume_dir.empty()) {
+    // Only save states at printing times, before the stimulus onset
+    const double start_time = toml::find<double>(cell_params, "start_time");
+    settings.warm_start_time = std::floor(start_time / print_timestep) *
+      print_timestep;
+
+    if (settings.warm_start_time > 0.0 &&
+        settings.warm_start_time < sim_duration) {
+      settings.warm_start_key = warm_start_key(dim, sys_params, cell_params,
+                                               mesh_path,
+                                               settings.warm_start_time);
+    }
+  }
+
   std::string save_path = cell_type + "/" + save_dir + "/" + stimulus_type;
 
   // Log file location
@@ -72,6 +750,7 @@ void run_simulation(const int dim) {
   OutputFileHandler output_file_handler(log_dir, false);
   std::string log_path =
     output_file_handler.GetOutputDirectoryFullPath() + "log.log";
+  settings.log_path = log_path;
 
   HeartConfig::Instance()->SetSimulationDuration(sim_duration);  // ms
   HeartConfig::Instance()->SetOutputDirectory(save_path);
@@ -93,6 +772,11 @@ void run_simulation(const int dim) {
   HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(ode_timestep,
     pde_timestep, print_timestep);
 
+  if (checkpoint_timestep > 0.0) {
+    HeartConfig::Instance()->SetCheckpointSimulation(true, checkpoint_timestep,
+                                                     max_checkpoints);
+  }
+
   // Print information on the simulation to screen
   std::cout << "Running " << dim << "D simulation..." << std::endl;
   std::cout << "System information" << std::endl;
@@ -106,8 +790,16 @@ void run_simulation(const int dim) {
   log_stream.open(log_path, ios::app);
 
   log_stream << "System information" << std::endl;
+  log_stream << "  config: " << (get_general_config_file().empty() ?
+    param_file : get_general_config_file()) << std::endl;
   log_stream << "  cell type: " <<  cell_type << std::endl;
   log_stream << "  mesh: " << mesh_name << std::endl;
+  if (coarsening > 0.0) {
+    log_stream << "  coarsening: " << coarsening << std::endl;
+  }
+  if (use_mesh_cache || !partition_source.empty() || coarsening > 0.0) {
+    log_stream << "  mesh cache: " << mesh_path << std::endl;
+  }
   log_stream << "  capacitance: " << capacitance << " uF/cm2" << std::endl;
   if (orthotropic) {
     log_stream << "  fibre conductivity = " << conductivities[0] << std::endl;
@@ -128,12 +820,79 @@ void run_simulation(const int dim) {
   log_stream << "  pde timestep: " << pde_timestep << " ms" << std::endl;
   log_stream << "  print timestep: " << print_timestep << " ms" << std::endl;
 
+  if (checkpoint_timestep > 0.0) {
+    log_stream << "  checkpoint timestep: " << checkpoint_timestep << " ms"
+      << std::endl;
+  }
+
+  if (!resume_dir.empty()) {
+    log_stream << "  resumed from: " << resume_dir << std::endl;
+  }
+
   log_stream.close();
 
+  // Skip the run if the same results were already computed
+  std::string result_key = "";
+
+  if (use_result_cache && resume_dir.empty()) {
+    // The source mesh, the cached copies of a mesh give the same results
+    result_key = result_cache_key(dim, sys_params, cell_params,
+                                  mesh_dir + mesh_name);
+    UterineResultCache result_cache(result_key);
+
+    log_stream.open(log_path, ios::app);
+    log_stream << "Result cache" << std::endl;
+    log_stream << "  key: " << result_key << std::endl;
+
+    if (result_cache.IsAvailable()) {
+      result_cache.Restore(save_path);
+      std::cout << "Result cache hit, results linked from "
+        << result_cache.GetCacheDir() << std::endl;
+      log_stream << "  cache: hit" << std::endl;
+      log_stream.close();
+      UterineEventHandler::EndEvent(UterineEventHandler::EVERYTHING);
+      return;
+    }
+
+    log_stream << "  cache: miss" << std::endl;
+    log_stream.close();
+  }
+
+  // Everything up to here is part of the configuration
+  const std::chrono::duration<double> config_time =
+    std::chrono::steady_clock::now() - run_start;
+  const char* num_threads = getenv("OMP_NUM_THREADS");
+
+  manifest.SetNumber("dim", dim);
+  manifest.SetString("cell_type", cell_type);
+  manifest.SetString("stimulus_type", stimulus_type);
+  manifest.SetString("mesh", mesh_path);
+  manifest.SetString("resumed_from", resume_dir);
+  manifest.SetString("result_key", result_key);
+  manifest.SetEntry("stopped_early", "false");
+  manifest.SetString("config_hash", hash_to_string(
+    hash_toml(cell_params, hash_toml(sys_params))));
+  manifest.SetConfig("config", sys_params);
+  manifest.SetConfig("cell_config", cell_params);
+  manifest.SetNumber("num_procs", PetscTools::GetNumProcs());
+  // Chaste solvers run one thread per process unless OpenMP is enabled
+  manifest.SetNumber("num_threads",
+                     num_threads == NULL ? 1 : std::atoi(num_threads));
+  manifest.AddPhaseTime("config",
+                        config_time.count() - mesh_cache_time.count());
+  manifest.AddPhaseTime("mesh_cache", mesh_cache_time.count());
+
+  if (use_sampling_profiler) {
+    UterineSamplingProfiler::Start(
+      toml::find_or<double>(sys_params, "sampling_interval", 1.0),
+      toml::find_or<double>(sys_params, "sampling_buffer", 64.0) *
+      1024 * 1024);
+  }
+
   if (dim == 2) {
-    simulation_2d(stimulus_type, log_path);
+    simulation_2d(settings);
   } else if (dim == 3) {
-    simulation_3d(stimulus_type, log_path);
+    simulation_3d(settings);
   } else {
     const std::string err_msg = "Invalid dimension";
     const std::string err_filename = "main.cpp";
@@ -142,67 +901,142 @@ void run_simulation(const int dim) {
   throw Exception(err_msg, err_filename, line_number);
   }
 
-  HeartEventHandler::Headings();
-  HeartEventHandler::Report();
-}
+  UterineEventHandler::EndEvent(UterineEventHandler::EVERYTHING);
+  UterineEventHandler::ReportWithHeart();
 
+  if (settings.memory_report) {
+    UterineMemoryReport::WritePeakRss(log_path);
+  }
 
-void simulation_2d(std::string stimulus_type, std::string log_path) {
-  constexpr int DIM = 2;
+  // Write the manifest next to the results
+  const std::chrono::duration<double> wall_time =
+    std::chrono::steady_clock::now() - run_start;
+  OutputFileHandler results_handler(
+    HeartConfig::Instance()->GetOutputDirectory(), false);
+  const std::string manifest_path =
+    results_handler.GetOutputDirectoryFullPath() + "manifest.json";
 
-  AbstractUterineCellFactoryTemplate<DIM> *factory = NULL;
+  if (use_sampling_profiler) {
+    // One profile per process, they can be concatenated
+    std::stringstream profile_name;
+    profile_name << "profile_" << PetscTools::GetMyRank() << ".folded";
+    UterineSamplingProfiler::Write(
+      results_handler.GetOutputDirectoryFullPath() + profile_name.str());
 
-  if (stimulus_type == "simple") {
-    factory = new UterineSimpleCellFactory<DIM>();
-  } else if (stimulus_type == "regular") {
-    factory = new UterineRegularCellFactory<DIM>();
-  } else if (stimulus_type == "region") {
-    factory = new UterineRegionCellFactory<DIM>();
-  } else if (stimulus_type == "zero") {
-    factory = new UterineZeroCellFactory<DIM>();
-  } else {
-    const std::string err_message = "Unrecognized stimulus type";
-    const std::string err_filename = "simulation.cpp";
-    unsigned line_number = 166;
+    if (PetscTools::AmMaster()) {
+      std::cout << "Sampling profile written to "
+        << results_handler.GetOutputDirectoryFullPath() << profile_name.str()
+        << std::endl;
+      log_stream.open(log_path, ios::app);
+      log_stream << "Sampling profiler" << std::endl;
+      log_stream << "  samples: " << UterineSamplingProfiler::GetNumSamples()
+        << std::endl;
+      log_stream << "  dropped samples: "
+        << UterineSamplingProfiler::GetNumDropped() << std::endl;
+      log_stream.close();
+    }
+  }
 
-    throw Exception(err_message, err_filename, line_number);
+  manifest.AddHeartEventTimes();
+  manifest.AddUterineEventTimes();
+  manifest.SetNumber("wall_time", wall_time.count());
+  manifest.Write(manifest_path);
+  std::cout << "Manifest written to " << manifest_path << std::endl;
+
+  // Effective configuration, with the overrides, to run it again with
+  // --config
+  if (PetscTools::AmMaster()) {
+    std::ofstream config_file(results_handler.GetOutputDirectoryFullPath() +
+                              "config.toml");
+    config_file << sys_params;
+    config_file.close();
+
+    std::ofstream cell_config_file(
+      results_handler.GetOutputDirectoryFullPath() + "cell_config.toml");
+    cell_config_file << cell_params;
+    cell_config_file.close();
+  }
+
+  if (!result_key.empty()) {
+    // Only complete runs get here
+    UterineResultCache(result_key).Store(
+      HeartConfig::Instance()->GetOutputDirectory());
+  }
+}
+
+
+void simulation_2d(const SimulationSettings& settings) {
+  constexpr int DIM = 2;
+
+  if (!settings.resume_dir.empty()) {
+    UterineMonodomainProblem<DIM>* p_problem =
+      load_checkpoint<DIM>(settings.resume_dir);
+    record_mesh_size(*p_problem, settings);
+    report_memory(*p_problem, settings);
+    report_progress(*p_problem, settings);
+    solve_with_checkpoints(*p_problem, NULL, settings);
+    delete p_problem;
+    return;
   }
 
-  factory->WriteLogInfo(log_path);
+  AbstractUterineCellFactoryTemplate<DIM>* factory =
+    create_cell_factory<DIM>(settings.stimulus_type);
 
-  MonodomainProblem<DIM> monodomain_problem(factory);
+  factory->WriteLogInfo(settings.log_path);
 
+  // Declared before the problem so that it outlives it
+  DistributedTetrahedralMesh<DIM, DIM> mesh(
+    DistributedTetrahedralMeshPartitionType::DUMB);
+  UterineMonodomainProblem<DIM> monodomain_problem(factory);
+
+  set_up_mesh(monodomain_problem, mesh, settings);
   monodomain_problem.Initialise();
-  monodomain_problem.Solve();
+  record_mesh_size(monodomain_problem, settings);
+  report_memory(monodomain_problem, settings);
+  report_progress(monodomain_problem, settings);
+  solve_problem(monodomain_problem, NULL, settings);
 }
 
 
-void simulation_3d(std::string stimulus_type, std::string log_path) {
+void simulation_3d(const SimulationSettings& settings) {
   // Include passive cell params to input arguments
   constexpr int DIM = 3;
 
-  AbstractUterineCellFactoryTemplate<DIM> *factory = NULL;
+  if (!settings.resume_dir.empty()) {
+    UterineMonodomainProblem<DIM>* p_problem =
+      load_checkpoint<DIM>(settings.resume_dir);
+    record_mesh_size(*p_problem, settings);
+    report_memory(*p_problem, settings);
+    report_progress(*p_problem, settings);
+    UterineConductivityModifier modifier;
 
-  if (stimulus_type == "simple") {
-    factory = new UterineSimpleCellFactory<DIM>();
-  } else if (stimulus_type == "regular") {
-    factory = new UterineRegularCellFactory<DIM>();
-  } else if (stimulus_type == "region") {
-    factory = new UterineRegionCellFactory<DIM>();
-  } else if (stimulus_type == "zero") {
-    factory = new UterineZeroCellFactory<DIM>();
-  } else {
-    const std::string err_message = "Unrecognized stimulus type";
-    const std::string err_filename = "simulation.cpp";
-    unsigned line_number = 197;
+    if (load_modifier(modifier, settings.resume_dir)) {
+      // Set up the tissue conductivity modifier again for passive cells
+      modifier.SetMesh(&p_problem->rGetMesh());
+      p_problem->GetMonodomainTissue()->SetConductivityModifier(&modifier);
+      solve_with_checkpoints(*p_problem, &modifier, settings);
+    } else {
+      solve_with_checkpoints(*p_problem, NULL, settings);
+    }
 
-    throw Exception(err_message, err_filename, line_number);
+    delete p_problem;
+    return;
   }
-  factory->WriteLogInfo(log_path);
 
-  MonodomainProblem<DIM> monodomain_problem(factory);
+  AbstractUterineCellFactoryTemplate<DIM>* factory =
+    create_cell_factory<DIM>(settings.stimulus_type);
+  factory->WriteLogInfo(settings.log_path);
 
+  // Declared before the problem so that it outlives it
+  DistributedTetrahedralMesh<DIM, DIM> mesh(
+    DistributedTetrahedralMeshPartitionType::DUMB);
+  UterineMonodomainProblem<DIM> monodomain_problem(factory);
+
+  set_up_mesh(monodomain_problem, mesh, settings);
   monodomain_problem.Initialise();
+  record_mesh_size(monodomain_problem, settings);
+  report_memory(monodomain_problem, settings);
+  report_progress(monodomain_problem, settings);
   std::string cell_type = factory->GetCellType();
 
   if (cell_type[cell_type.length() -1] == 'P') {
@@ -214,8 +1048,8 @@ void simulation_3d(std::string stimulus_type, std::string log_path) {
     HeartConfig::Instance()->SetOutputVariables(output_variables);
 
     // Get the parameters for the passive cell
-    const auto cell_params = toml::parse(USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
-                                         factory->GetCellParamFile());
+    const auto cell_params = read_config(USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+                                         factory->GetCellParamFile(), "cell");
     const auto& passive_params = toml::find(cell_params, "passive");
     std::vector<double> conductivities = toml::find<std::vector<double>>(
       cell_params, "conductivities_3d");
@@ -230,9 +1064,171 @@ void simulation_3d(std::string stimulus_type, std::string log_path) {
 
     MonodomainTissue<3>* tissue = monodomain_problem.GetMonodomainTissue();
     tissue->SetConductivityModifier(&modifier);
-    monodomain_problem.Solve();  // Need this here otherwise code breaks
+    // Need this here otherwise code breaks
+    solve_problem(monodomain_problem, &modifier, settings);
 
   } else {  // Need this here otherwise code breaks
-    monodomain_problem.Solve();
+    solve_problem(monodomain_problem, NULL, settings);
+  }
+}
+
+
+void save_modifier(UterineConductivityModifier* modifier,
+                   std::string archive_dir) {
+  FileFinder archive_finder(archive_dir, RelativeTo::ChasteTestOutput);
+  ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(
+    archive_finder, "uterine_modifier.arch");
+  boost::archive::text_oarchive* p_arch = arch_opener.GetCommonArchive();
+
+  const UterineConductivityModifier& r_modifier = *modifier;
+  (*p_arch) << r_modifier;
+}
+
+
+bool load_modifier(UterineConductivityModifier& modifier,
+                   std::string archive_dir) {
+  FileFinder modifier_file(archive_dir + "/uterine_modifier.arch",
+                           RelativeTo::ChasteTestOutput);
+
+  if (!modifier_file.Exists()) {
+    return false;  // No modifier was used in the archived simulation
+  }
+
+  FileFinder archive_finder(archive_dir, RelativeTo::ChasteTestOutput);
+  ArchiveOpener<boost::archive::text_iarchive, std::ifstream> arch_opener(
+    archive_finder, "uterine_modifier.arch");
+  boost::archive::text_iarchive* p_arch = arch_opener.GetCommonArchive();
+
+  (*p_arch) >> modifier;
+  return true;
+}
+
+
+std::string warm_start_key(const int dim, const toml::value& sys_params,
+                           const toml::value& cell_params,
+                           std::string mesh_path, double warm_start_time) {
+  const std::string cell_type = toml::find<std::string>(sys_params,
+                                                        "cell_type");
+  std::uint64_t key = hash_string(cell_type);
+
+  // Mesh
+  key = hash_combine(key, dim);
+  key = hash_combine(key, hash_file(mesh_path + ".node"));
+  key = hash_combine(key, hash_file(mesh_path + ".ele"));
+
+  // Cell model and parameters
+  key = hash_toml(toml::find_or(sys_params, "estrus", toml::value("")), key);
+  key = hash_toml(toml::find(cell_params, "cell_id"), key);
+  key = hash_toml(toml::find(cell_params, "capacitance"), key);
+  key = hash_toml(toml::find_or(cell_params, "parameters", toml::value()), key);
+  key = hash_toml(toml::find_or(cell_params, "passive", toml::value()), key);
+
+  // Solver settings
+  key = hash_toml(toml::find(sys_params, "ode_timestep"), key);
+  key = hash_toml(toml::find(sys_params, "pde_timestep"), key);
+  key = hash_string(std::to_string(warm_start_time), key);
+  // States solved in single precision are rounded
+  key = hash_toml(toml::find_or(sys_params, "float_states", toml::value(false)),
+                  key);
+
+  // Non-excitable nodes have their own cell model, given by the node labels
+  // of the mesh files or by the stimulus regions of the mesh configuration
+  const auto passive_regions = toml::find_or<std::vector<std::string>>(
+    sys_params, "passive_tissue_regions", std::vector<std::string>());
+  const bool passive_tissue = !passive_regions.empty() ||
+    toml::find_or<int>(sys_params, "passive_tissue_label", -1) >= 0;
+
+  if (passive_tissue) {
+    const std::vector<std::string> passive_tissue_keys = {
+      "passive_tissue_regions", "passive_tissue_label",
+      "passive_tissue_g_leak", "passive_tissue_e_leak"};
+
+    for (const auto& passive_tissue_key : passive_tissue_keys) {
+      key = hash_toml(toml::find_or(sys_params, passive_tissue_key,
+                                    toml::value()), key);
+    }
+
+    const std::string mesh_param_file = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+      "mesh/" + toml::find<std::string>(sys_params, "mesh_name") + ".toml";
+
+    if (!passive_regions.empty() && std::ifstream(mesh_param_file).good()) {
+      key = hash_toml(read_config(mesh_param_file, "mesh"), key);
+    }
   }
+
+  if (cell_type[cell_type.length() -1] == 'P' || passive_tissue) {
+    // The passive cells and non-excitable nodes are not uniform along the
+    // mesh so the tissue state also depends on the conductivities and the
+    // stimulated cells which do not receive the passive parameters
+    const std::vector<std::string> passive_keys = {
+      "orthotropic", "stimulus_type", "x_stim_start", "x_stim_end",
+      "y_stim_start", "y_stim_end", "z_stim_start", "z_stim_end"};
+
+    for (const auto& passive_key : passive_keys) {
+      key = hash_toml(toml::find_or(sys_params, passive_key, toml::value()),
+                      key);
+    }
+    key = hash_toml(toml::find_or(cell_params, "conductivities_2d",
+                                  toml::value()), key);
+    key = hash_toml(toml::find_or(cell_params, "conductivities_3d",
+                                  toml::value()), key);
+    key = hash_toml(toml::find_or(cell_params, "ortho_conductivities",
+                                  toml::value()), key);
+  }
+  return hash_to_string(key);
+}
+
+
+std::string result_cache_key(const int dim, const toml::value& sys_params,
+                             const toml::value& cell_params,
+                             std::string mesh_path) {
+  // Settings that change the results. The diagnostics, caches, checkpoints
+  // and the storage of the cells do not, and the mesh files are hashed
+  // rather than their location.
+  const std::vector<std::string> result_keys = {
+    "mesh_name", "orthotropic", "coarsening", "cell_type", "estrus",
+    "stimulus_type", "x_stim_start", "x_stim_end", "y_stim_start",
+    "y_stim_end", "z_stim_start", "z_stim_end", "region_seed",
+    "monte_carlo_runs", "activation_threshold", "activation_map",
+    "sim_duration", "ode_timestep", "pde_timestep", "print_timestep",
+    "warm_start", "early_stop", "rest_threshold", "rest_check_interval",
+    "float_states", "passive_tissue_regions", "passive_tissue_label",
+    "passive_tissue_g_leak", "passive_tissue_e_leak"};
+  toml::value result_params = toml::table{};
+
+  for (const auto& result_key : result_keys) {
+    if (sys_params.contains(result_key)) {
+      result_params.as_table()[result_key] = sys_params.at(result_key);
+    }
+  }
+
+  std::uint64_t key = hash_string(std::to_string(dim));
+  key = hash_toml(result_params, key);
+  key = hash_toml(cell_params, key);
+
+  // Mesh, fibres and stimulus regions
+  for (const auto& extension : {".node", ".ele", ".face", ".ortho"}) {
+    const std::string mesh_file = mesh_path + extension;
+
+    if (std::ifstream(mesh_file).good()) {  // Faces and fibres are optional
+      key = hash_combine(key, hash_file(mesh_file));
+    }
+  }
+
+  const std::string mesh_param_file = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+    "mesh/" + toml::find<std::string>(sys_params, "mesh_name") + ".toml";
+
+  if (std::ifstream(mesh_param_file).good()) {
+    key = hash_toml(read_config(mesh_param_file, "mesh"), key);
+  }
+
+  // Code version, a modified working copy also depends on the build
+  key = hash_string(ChasteBuildInfo::GetVersionString(), key);
+  key = hash_string(ChasteBuildInfo::GetProjectVersions(), key);
+
+  if (ChasteBuildInfo::IsWorkingCopyModified()) {
+    key = hash_string(ChasteBuildInfo::GetBuildTime(), key);
+  }
+
+  return hash_to_string(key);
 }
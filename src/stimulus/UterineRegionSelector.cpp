@@ -4,7 +4,8 @@ UterineRegionSelector::UterineRegionSelector() :
       mpCurrentRegion(0),
       mpOvariesProb(1.0),
       mpCentreProb(0.0),
-      mpCervicalProb(0.0) {
+      mpCervicalProb(0.0),
+      mpGenerator(982) {
 }
 
 
@@ -15,10 +16,9 @@ double UterineRegionSelector::GetStimulus(double time) {
 
 unsigned UterineRegionSelector::SelectRegion() {
     // Generate a random number between 0 and 1
-    static std::mt19937 mt(982);  // Random number generator
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-    double rand_val = dist(mt);
+    double rand_val = dist(mpGenerator);
 
     if (rand_val < mpOvariesProb) {
       return 1;  // Ovaries region
@@ -51,6 +51,21 @@ void UterineRegionSelector::SetCurrentRegion(unsigned region) {
 }
 
 
+void UterineRegionSelector::SetSeed(unsigned seed) {
+    mpGenerator.seed(seed);
+    mpCurrentRegion = 0;
+}
+
+
+void UterineRegionSelector::SetStream(unsigned seed, unsigned stream) {
+    // Mixing the seed and the stream index gives independent and
+    // reproducible sequences for each Monte Carlo realisation
+    std::seed_seq stream_seed{seed, stream};
+    mpGenerator.seed(stream_seed);
+    mpCurrentRegion = 0;
+}
+
+
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(UterineRegionSelector)
@@ -39,3 +39,13 @@ void UterineRegionStimulus::SetRegionProbs(
 void UterineRegionStimulus::SetRegion(unsigned region) {
     mpRegion = region;
 }
+
+
+boost::shared_ptr<UterineRegionSelector> UterineRegionStimulus::GetSelector() {
+    return mpSelector;
+}
+
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+CHASTE_CLASS_EXPORT(UterineRegionStimulus)
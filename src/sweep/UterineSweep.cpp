@@ -0,0 +1,367 @@
+#include "../../include/sweep/UterineSweep.hpp"
+
+namespace {
+std::string point_suffix(unsigned index) {
+  std::ostringstream suffix_stream;
+  suffix_stream << std::setw(3) << std::setfill('0') << index;
+  return suffix_stream.str();
+}
+
+
+void flatten_grid(const toml::value& grid, const std::string& prefix,
+                  std::vector<std::string>& keys,
+                  std::vector<toml::array>& values) {
+  for (const auto& [key, value] : grid.as_table()) {
+    if (value.is_table()) {  // Dotted keys are read as nested tables
+      flatten_grid(value, prefix + key + ".", keys, values);
+    } else if (value.is_array() && !value.as_array().empty()) {
+      keys.push_back(prefix + key);
+      values.push_back(value.as_array());
+    } else {
+      const std::string err_msg = "Sweep grid values of " + prefix + key +
+        " must be a non-empty array";
+      const std::string err_filename = "UterineSweep.cpp";
+      unsigned line_number = 25;
+      throw Exception(err_msg, err_filename, line_number);
+    }
+  }
+}
+
+
+template <unsigned DIM>
+std::vector<std::vector<double>> read_nodes(const std::string& mesh_path) {
+  TrianglesMeshReader<DIM, DIM> mesh_reader(mesh_path);
+  std::vector<std::vector<double>> nodes;
+
+  for (unsigned i = 0; i < mesh_reader.GetNumNodes(); ++i) {
+    nodes.push_back(mesh_reader.GetNextNode());
+  }
+  return nodes;
+}
+}  // namespace
+
+
+UterineSweep::UterineSweep(int dim, std::string sweep_file) :
+  mDim(dim),
+  mScreeningCoarsening(0.0),
+  mMinActivatedFraction(0.0),
+  mHasTarget(false),
+  mTargetMin(3, -std::numeric_limits<double>::infinity()),
+  mTargetMax(3, std::numeric_limits<double>::infinity()) {
+  const std::string sweep_path = find_config_file(sweep_file);
+  const auto sweep = toml::parse(sweep_path);
+  const toml::value grid = sweep.contains("grid") ?
+    toml::find(sweep, "grid") : toml::value(toml::table{});
+
+  if (sweep.contains("points")) {
+    const auto& points = toml::find(sweep, "points").as_array();
+
+    for (unsigned i = 0; i < points.size(); ++i) {
+      toml::value overrides = points[i];
+      std::string name = toml::find_or<std::string>(overrides, "name", "");
+
+      if (name.empty()) {
+        name = "point_" + point_suffix(i);
+      }
+      overrides.as_table().erase("name");
+      AddGrid(name, overrides, grid);
+    }
+  } else {
+    AddGrid("point", toml::table{}, grid);
+  }
+
+  if (mPointNames.empty()) {
+    const std::string err_msg = "Sweep " + sweep_path + " has no points";
+    const std::string err_filename = "UterineSweep.cpp";
+    unsigned line_number = 77;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  // Points are first run on a coarse mesh, only those that activate enough
+  // of the tissue are run on the full mesh
+  if (sweep.contains("screening")) {
+    const auto& screening = toml::find(sweep, "screening");
+    mScreeningCoarsening = toml::find<double>(screening, "coarsening");
+    mMinActivatedFraction = toml::find_or<double>(screening,
+      "min_activated_fraction", 0.0);
+
+    if (screening.contains("target")) {
+      // Axes left out of the target region are not bounded
+      const auto& target = toml::find(screening, "target");
+      const std::vector<std::string> axes = {"x", "y", "z"};
+      mHasTarget = true;
+
+      for (unsigned d = 0; d < axes.size(); ++d) {
+        if (target.contains(axes[d])) {
+          const auto range = toml::find<std::vector<double>>(target, axes[d]);
+          mTargetMin[d] = range.at(0);
+          mTargetMax[d] = range.at(1);
+        }
+      }
+    }
+  }
+}
+
+
+void UterineSweep::AddGrid(const std::string& name,
+                           const toml::value& overrides,
+                           const toml::value& grid) {
+  std::vector<std::string> keys;
+  std::vector<toml::array> values;
+  flatten_grid(grid, "", keys, values);
+
+  if (keys.empty()) {
+    mPointNames.push_back(name);
+    mPointOverrides.push_back(overrides);
+    return;
+  }
+
+  // Cartesian product of the grid values, the last key varies fastest
+  unsigned nb_combinations = 1;
+
+  for (const auto& key_values : values) {
+    nb_combinations *= key_values.size();
+  }
+
+  for (unsigned combination = 0; combination < nb_combinations;
+       ++combination) {
+    toml::value point = overrides;
+    unsigned remainder = combination;
+
+    for (unsigned k = keys.size(); k-- > 0;) {
+      set_toml_path(point, keys[k], values[k][remainder % values[k].size()]);
+      remainder /= values[k].size();
+    }
+
+    mPointNames.push_back(name + "_" + point_suffix(combination));
+    mPointOverrides.push_back(point);
+  }
+}
+
+
+unsigned UterineSweep::GetNumPoints() {
+  return mPointNames.size();
+}
+
+
+std::string UterineSweep::GetPointName(unsigned index) {
+  return mPointNames.at(index);
+}
+
+
+const toml::value& UterineSweep::GetPointOverrides(unsigned index) {
+  return mPointOverrides.at(index);
+}
+
+
+toml::value UterineSweep::GetOverrides(unsigned index, bool screening) {
+  // The point overrides apply on top of those of the command line
+  const toml::value base_overrides = get_config_overrides();
+  toml::value overrides = base_overrides;
+  merge_toml(overrides, mPointOverrides.at(index));
+  const std::string general_param_file = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+    (mDim == 2 ? USMC_SYSTEM_CONSTANTS::GENERAL_2D_PARAM_FILE :
+     USMC_SYSTEM_CONSTANTS::GENERAL_3D_PARAM_FILE);
+
+  toml::value general_params;
+  {
+    ScopedConfigOverrides point_overrides(overrides);
+    general_params = read_config(general_param_file, "general");
+  }
+
+  // Save each point in its own folder unless the point sets it
+  std::string save_dir = toml::find<std::string>(general_params, "save_dir");
+  const toml::value& point_overrides = mPointOverrides.at(index);
+
+  if (!point_overrides.contains("general") ||
+      !point_overrides.at("general").contains("save_dir")) {
+    save_dir += "/" + mPointNames.at(index);
+  }
+
+  if (screening) {
+    // Kept apart from the results of the full run
+    save_dir += "/screening";
+    set_toml_path(overrides, "general.coarsening",
+                  toml::value(mScreeningCoarsening));
+    set_toml_path(overrides, "general.activation_map", toml::value(true));
+  }
+  set_toml_path(overrides, "general.save_dir", toml::value(save_dir));
+  return overrides;
+}
+
+
+bool UterineSweep::IsScreening() {
+  return mScreeningCoarsening > 0.0;
+}
+
+
+bool UterineSweep::IsPromoted(unsigned index) {
+  if (!IsScreening()) {
+    return true;
+  }
+
+  // Read the activation map of the screening run
+  bool screened = false;
+  bool promoted = false;
+
+  if (PetscTools::AmMaster()) {
+    const std::string general_param_file = USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+      (mDim == 2 ? USMC_SYSTEM_CONSTANTS::GENERAL_2D_PARAM_FILE :
+       USMC_SYSTEM_CONSTANTS::GENERAL_3D_PARAM_FILE);
+    toml::value general_params;
+    {
+      ScopedConfigOverrides point_overrides(GetOverrides(index, true));
+      general_params = read_config(general_param_file, "general");
+    }
+
+    const std::string results_dir =
+      OutputFileHandler::GetChasteTestOutputDirectory() +
+      toml::find<std::string>(general_params, "cell_type") + "/" +
+      toml::find<std::string>(general_params, "save_dir") + "/" +
+      toml::find<std::string>(general_params, "stimulus_type") + "/";
+    std::ifstream stats_file(results_dir + "activation_stats.csv");
+
+    if (stats_file.is_open()) {
+      // Coordinates of the coarse mesh nodes, only needed for a target
+      std::vector<std::vector<double>> nodes;
+
+      if (mHasTarget) {
+        const std::string mesh_path = getenv("CHASTE_SOURCE_DIR") +
+          toml::find<std::string>(general_params, "mesh_dir") +
+          toml::find<std::string>(general_params, "mesh_name");
+        const std::string mesh_name = toml::find<std::string>(general_params,
+                                                              "mesh_name");
+        const std::string cache_dir =
+          OutputFileHandler::GetChasteTestOutputDirectory() + (mDim == 2 ?
+          UterineCoarseMesh<2>(mesh_path, mScreeningCoarsening).GetCacheDir() :
+          UterineCoarseMesh<3>(mesh_path, mScreeningCoarsening).GetCacheDir());
+
+        nodes = mDim == 2 ? read_nodes<2>(cache_dir + "/" + mesh_name) :
+          read_nodes<3>(cache_dir + "/" + mesh_name);
+      }
+
+      // Rows are node,probability,mean_activation_time,std_activation_time
+      std::string line;
+      unsigned num_nodes = 0;
+      unsigned num_activated = 0;
+      bool target_activated = false;
+      std::getline(stats_file, line);  // Header
+
+      while (std::getline(stats_file, line)) {
+        std::istringstream line_stream(line);
+        unsigned node = 0;
+        double probability = 0.0;
+        char separator;
+        line_stream >> node >> separator >> probability;
+        ++num_nodes;
+
+        if (probability < 0.5) {
+          continue;
+        }
+
+        ++num_activated;
+
+        if (mHasTarget && !target_activated) {
+          target_activated = true;
+
+          for (unsigned d = 0; d < nodes.at(node).size(); ++d) {
+            target_activated = target_activated &&
+              nodes[node][d] >= mTargetMin[d] &&
+              nodes[node][d] <= mTargetMax[d];
+          }
+        }
+      }
+
+      screened = true;
+      promoted = num_nodes > 0 &&
+        num_activated >= mMinActivatedFraction * num_nodes &&
+        (!mHasTarget || target_activated);
+    }
+  }
+
+  // Points whose screening failed are already reported as failed
+  promoted = PetscTools::ReplicateBool(promoted);
+
+  if (PetscTools::ReplicateBool(screened) && !promoted) {
+    std::cout << "Sweep point " << mPointNames.at(index) << " screened out"
+      << std::endl;
+    mScreenedOutPoints.push_back(mPointNames.at(index));
+  }
+  return promoted;
+}
+
+
+void UterineSweep::RunPoint(unsigned index, bool screening) {
+  // The overrides of the command line are restored even if the point fails
+  ScopedConfigOverrides point_overrides(GetOverrides(index, screening));
+
+  std::cout << (screening ? "Screening sweep point " : "Sweep point ")
+    << index + 1 << "/" << GetNumPoints() << ": " << mPointNames.at(index)
+    << std::endl;
+
+  // The mesh is kept in memory for the next points
+  run_simulation(mDim, "", true);
+}
+
+
+bool UterineSweep::TryRunPoint(unsigned index, bool screening) {
+  try {
+    RunPoint(index, screening);
+  } catch (const Exception& e) {
+    // Carry on with the other points
+    std::cout << "Sweep point " << mPointNames.at(index) << " failed: "
+      << e.GetShortMessage() << std::endl;
+    mFailedPoints.push_back(mPointNames.at(index));
+    return false;
+  } catch (const std::exception& e) {
+    // Bad overrides of a point throw toml and standard library errors
+    std::cout << "Sweep point " << mPointNames.at(index) << " failed: "
+      << e.what() << std::endl;
+    mFailedPoints.push_back(mPointNames.at(index));
+    return false;
+  }
+  return true;
+}
+
+
+void UterineSweep::Finish() {
+  UterineSharedMesh<2>::Clear();
+  UterineSharedMesh<3>::Clear();
+
+  if (!mScreenedOutPoints.empty()) {
+    std::cout << "Sweep points screened out:";
+
+    for (const auto& name : mScreenedOutPoints) {
+      std::cout << " " << name;
+    }
+    std::cout << std::endl;
+  }
+
+  if (!mFailedPoints.empty()) {
+    std::string err_msg = "Sweep points failed:";
+
+    for (const auto& name : mFailedPoints) {
+      err_msg += " " + name;
+    }
+
+    const std::string err_filename = "UterineSweep.cpp";
+    unsigned line_number = 346;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+}
+
+
+void UterineSweep::Run() {
+  if (IsScreening()) {
+    for (unsigned i = 0; i < GetNumPoints(); ++i) {
+      TryRunPoint(i, true);
+    }
+  }
+
+  for (unsigned i = 0; i < GetNumPoints(); ++i) {
+    if (IsPromoted(i)) {
+      TryRunPoint(i);
+    }
+  }
+  Finish();
+}
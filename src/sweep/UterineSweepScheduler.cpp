@@ -0,0 +1,145 @@
+#include "../../include/sweep/UterineSweepScheduler.hpp"
+
+bool UterineSweepScheduler::mInitialisedMpi = false;
+unsigned UterineSweepScheduler::mGroupSize = 0;
+int UterineSweepScheduler::mGroupIndex = 0;
+int UterineSweepScheduler::mNumGroups = 1;
+
+
+void UterineSweepScheduler::InitialiseGroups(int* pArgc, char*** pArgv,
+                                             unsigned group_size) {
+  // PETSC_COMM_WORLD can only be changed before PETSc is initialised
+  MPI_Init(pArgc, pArgv);
+  mInitialisedMpi = true;
+
+  int world_rank;
+  int world_size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+  if (group_size == 0 || static_cast<int>(group_size) > world_size) {
+    group_size = world_size;
+  }
+
+  MPI_Comm group_comm;
+  mGroupSize = group_size;
+  mGroupIndex = world_rank / group_size;
+  mNumGroups = (world_size + group_size - 1) / group_size;
+  MPI_Comm_split(MPI_COMM_WORLD, mGroupIndex, world_rank, &group_comm);
+
+  PETSC_COMM_WORLD = group_comm;
+}
+
+
+void UterineSweepScheduler::FinaliseGroups() {
+  // PETSc does not finalise MPI if it did not initialise it
+  if (mInitialisedMpi) {
+    MPI_Finalize();
+    mInitialisedMpi = false;
+  }
+}
+
+
+unsigned UterineSweepScheduler::GetGroupSize() {
+  return mGroupSize;
+}
+
+
+int UterineSweepScheduler::GetGroupIndex() {
+  return mGroupIndex;
+}
+
+
+int UterineSweepScheduler::GetNumGroups() {
+  return mNumGroups;
+}
+
+
+UterineSweepScheduler::UterineSweepScheduler() : mpCounter(NULL) {
+  int world_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+
+  // The counter lives on the first process, the others access it remotely
+  MPI_Aint window_size = (world_rank == 0) ? sizeof(int) : 0;
+  MPI_Win_allocate(window_size, sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD,
+                   &mpCounter, &mCounterWindow);
+
+  if (world_rank == 0) {
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, mCounterWindow);
+    *mpCounter = 0;
+    MPI_Win_unlock(0, mCounterWindow);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+
+UterineSweepScheduler::~UterineSweepScheduler() {
+  MPI_Win_free(&mCounterWindow);
+}
+
+
+int UterineSweepScheduler::GetNextPoint() {
+  int next_point = 0;
+
+  // The first process of the group takes the next point from the queue
+  if (PetscTools::AmMaster()) {
+    const int increment = 1;
+
+    MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, mCounterWindow);
+    MPI_Fetch_and_op(&increment, &next_point, MPI_INT, 0, 0, MPI_SUM,
+                     mCounterWindow);
+    MPI_Win_unlock(0, mCounterWindow);
+  }
+
+  MPI_Bcast(&next_point, 1, MPI_INT, 0, PETSC_COMM_WORLD);
+  return next_point;
+}
+
+
+void UterineSweepScheduler::ResetQueue() {
+  // All the groups must be done with the queue before it starts again
+  int world_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (world_rank == 0) {
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, mCounterWindow);
+    *mpCounter = 0;
+    MPI_Win_unlock(0, mCounterWindow);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+
+void UterineSweepScheduler::RunQueue(UterineSweep& sweep, bool screening) {
+  // Groups take a new point as soon as they are done with the previous one
+  int point = GetNextPoint();
+
+  while (point < static_cast<int>(sweep.GetNumPoints())) {
+    if (screening) {
+      std::cout << "Group " << mGroupIndex + 1 << "/" << mNumGroups
+        << " screening sweep point " << sweep.GetPointName(point)
+        << std::endl;
+      sweep.TryRunPoint(point, true);
+    } else if (sweep.IsPromoted(point)) {
+      std::cout << "Group " << mGroupIndex + 1 << "/" << mNumGroups
+        << " running sweep point " << sweep.GetPointName(point) << std::endl;
+      sweep.TryRunPoint(point);
+    }
+    point = GetNextPoint();
+  }
+}
+
+
+void UterineSweepScheduler::Run(UterineSweep& sweep) {
+  // The full runs read the results of all the screening runs
+  if (sweep.IsScreening()) {
+    RunQueue(sweep, true);
+    ResetQueue();
+  }
+  RunQueue(sweep, false);
+
+  // Wait for the other groups before freeing the queue
+  MPI_Barrier(MPI_COMM_WORLD);
+  sweep.Finish();
+}
@@ -0,0 +1,77 @@
+#include "../../include/utils/UterineEventHandler.hpp"
+
+const char* UterineEventHandler::EventName[] = {
+  "Toml", "ZroCell", "SimCell", "RegCell", "RgnCell", "FindRgn", "Passive",
+  "Run"};
+
+
+void UterineEventHandler::ReportWithHeart() {
+  // Columns of the Chaste events, then of the uterine ones, in ms here
+  std::vector<std::string> names;
+  std::vector<double> times;
+
+  for (unsigned i = 0; i <= HeartEventHandler::EVERYTHING; ++i) {
+    names.push_back(HeartEventHandler::EventName[i]);
+    times.push_back(HeartEventHandler::GetElapsedTime(i));
+  }
+
+  for (unsigned i = 0; i < EVERYTHING; ++i) {
+    names.push_back(EventName[i]);
+    times.push_back(GetElapsedTime(i));
+  }
+  names.push_back("CondMod");
+  times.push_back(UterineConductivityModifier::GetElapsedTime());
+  names.push_back(EventName[EVERYTHING]);
+  times.push_back(GetElapsedTime(EVERYTHING));
+
+  // Printed by the master, every process must call this
+  const unsigned num_events = times.size();
+  const unsigned num_procs = PetscTools::GetNumProcs();
+  std::vector<double> all_times(num_events * num_procs);
+  MPI_Gather(times.data(), num_events, MPI_DOUBLE, all_times.data(),
+             num_events, MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::vector<double> avg_times(num_events, 0.0);
+  std::vector<double> max_times(num_events, 0.0);
+
+  for (unsigned p = 0; p < num_procs; ++p) {
+    for (unsigned i = 0; i < num_events; ++i) {
+      avg_times[i] += all_times[p * num_events + i] / num_procs;
+      max_times[i] = std::max(max_times[i], all_times[p * num_events + i]);
+    }
+  }
+
+  // In s and as a share of the run, as the Chaste report
+  auto print_row = [num_events](const std::string& label,
+                                const double* pTimes) {
+    printf("%4s ", label.c_str());
+
+    for (unsigned i = 0; i < num_events; ++i) {
+      const double run_time = pTimes[num_events - 1];
+      printf("%7.2e ", pTimes[i] / 1000);
+      printf("(%3.0f%%)  ", run_time > 0 ? 100 * pTimes[i] / run_time : 0.0);
+    }
+    printf("(seconds) \n");
+  };
+
+  printf("Proc ");
+
+  for (const auto& name : names) {
+    printf("%15s%2s", name.c_str(), "");
+  }
+  printf("\n");
+
+  for (unsigned p = 0; p < num_procs; ++p) {
+    print_row(std::to_string(p) + ":", &all_times[p * num_events]);
+  }
+
+  if (num_procs > 1) {
+    print_row("avg:", avg_times.data());
+    print_row("max:", max_times.data());
+  }
+  fflush(stdout);
+}
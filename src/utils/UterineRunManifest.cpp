@@ -0,0 +1,149 @@
+#include "../../include/utils/UterineRunManifest.hpp"
+
+UterineRunManifest::UterineRunManifest() {
+}
+
+
+void UterineRunManifest::SetEntry(const std::string& key,
+                                  const std::string& json_value) {
+  for (auto& entry : mEntries) {
+    if (entry.first == key) {
+      entry.second = json_value;
+      return;
+    }
+  }
+  mEntries.push_back(std::make_pair(key, json_value));
+}
+
+
+void UterineRunManifest::SetString(const std::string& key,
+                                   const std::string& value) {
+  SetEntry(key, json_string(value));
+}
+
+
+void UterineRunManifest::SetNumber(const std::string& key, double value) {
+  SetEntry(key, json_number(value));
+}
+
+
+void UterineRunManifest::SetConfig(const std::string& key,
+                                   const toml::value& config) {
+  SetEntry(key, toml_to_json(config));
+}
+
+
+void UterineRunManifest::SetMeshSize(unsigned num_nodes,
+                                     unsigned num_elements) {
+  SetNumber("num_nodes", num_nodes);
+  SetNumber("num_elements", num_elements);
+}
+
+
+void UterineRunManifest::AddPhaseTime(const std::string& phase, double time) {
+  for (auto& phase_time : mPhaseTimes) {
+    if (phase_time.first == phase) {
+      phase_time.second += time;
+      return;
+    }
+  }
+  mPhaseTimes.push_back(std::make_pair(phase, time));
+}
+
+
+void UterineRunManifest::AddHeartEventTimes() {
+  // The event handler times are in ms
+  AddPhaseTime("mesh_load",
+    HeartEventHandler::GetElapsedTime(HeartEventHandler::READ_MESH)/1000);
+  AddPhaseTime("cell_creation",
+    HeartEventHandler::GetElapsedTime(HeartEventHandler::INITIALISE)/1000);
+  AddPhaseTime("assembly",
+    (HeartEventHandler::GetElapsedTime(HeartEventHandler::ASSEMBLE_SYSTEM) +
+     HeartEventHandler::GetElapsedTime(HeartEventHandler::ASSEMBLE_RHS))/1000);
+  AddPhaseTime("ode",
+    HeartEventHandler::GetElapsedTime(HeartEventHandler::SOLVE_ODES)/1000);
+  AddPhaseTime("linear_solve",
+    HeartEventHandler::GetElapsedTime(
+      HeartEventHandler::SOLVE_LINEAR_SYSTEM)/1000);
+  AddPhaseTime("output",
+    HeartEventHandler::GetElapsedTime(HeartEventHandler::WRITE_OUTPUT)/1000);
+  AddPhaseTime("vtk_conversion",
+    HeartEventHandler::GetElapsedTime(
+      HeartEventHandler::DATA_CONVERSION)/1000);
+}
+
+
+void UterineRunManifest::AddUterineEventTimes() {
+  // Sub-phases of those above, in s as well
+  AddPhaseTime("toml_parse",
+    UterineEventHandler::GetElapsedTime(UterineEventHandler::READ_CONFIG)/1000);
+  AddPhaseTime("cell_creation.create_cell",
+    (UterineEventHandler::GetElapsedTime(
+       UterineEventHandler::CREATE_ZERO_CELL) +
+     UterineEventHandler::GetElapsedTime(
+       UterineEventHandler::CREATE_SIMPLE_CELL) +
+     UterineEventHandler::GetElapsedTime(
+       UterineEventHandler::CREATE_REGULAR_CELL) +
+     UterineEventHandler::GetElapsedTime(
+       UterineEventHandler::CREATE_REGION_CELL))/1000);
+  AddPhaseTime("cell_creation.find_region",
+    UterineEventHandler::GetElapsedTime(UterineEventHandler::FIND_REGION)/1000);
+  AddPhaseTime("cell_creation.set_passive_params",
+    UterineEventHandler::GetElapsedTime(
+      UterineEventHandler::SET_PASSIVE_PARAMS)/1000);
+  AddPhaseTime("assembly.conductivity_modifier",
+    UterineConductivityModifier::GetElapsedTime()/1000);
+}
+
+
+void UterineRunManifest::Write(const std::string& file_path) {
+  // Keep the slowest process for each phase, every process must call this
+  std::vector<double> local_times;
+  std::vector<double> max_times(mPhaseTimes.size());
+
+  for (const auto& phase_time : mPhaseTimes) {
+    local_times.push_back(phase_time.second);
+  }
+  MPI_Reduce(local_times.data(), max_times.data(), local_times.size(),
+             MPI_DOUBLE, MPI_MAX, 0, PETSC_COMM_WORLD);
+
+  // Peak resident set size, in kB on Linux
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  double local_rss = usage.ru_maxrss/1024.0;
+  double max_rss = 0.0;
+  double total_rss = 0.0;
+
+  MPI_Reduce(&local_rss, &max_rss, 1, MPI_DOUBLE, MPI_MAX, 0,
+             PETSC_COMM_WORLD);
+  MPI_Reduce(&local_rss, &total_rss, 1, MPI_DOUBLE, MPI_SUM, 0,
+             PETSC_COMM_WORLD);
+
+  if (!PetscTools::AmMaster()) {
+    return;
+  }
+
+  std::ofstream manifest_file(file_path);
+  manifest_file << "{" << std::endl;
+
+  for (const auto& entry : mEntries) {
+    manifest_file << "  " << json_string(entry.first) << ": " << entry.second
+      << "," << std::endl;
+  }
+
+  manifest_file << "  \"phases\": {";
+
+  for (unsigned i = 0; i < mPhaseTimes.size(); ++i) {
+    manifest_file << (i == 0 ? "" : ",") << std::endl << "    "
+      << json_string(mPhaseTimes[i].first) << ": "
+      << json_number(max_times[i]);
+  }
+  manifest_file << std::endl << "  }," << std::endl;
+
+  manifest_file << "  \"peak_rss_mb\": " << json_number(max_rss) << ","
+    << std::endl;
+  manifest_file << "  \"total_peak_rss_mb\": " << json_number(total_rss)
+    << std::endl;
+  manifest_file << "}" << std::endl;
+  manifest_file.close();
+}
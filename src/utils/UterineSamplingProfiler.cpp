@@ -0,0 +1,192 @@
+#include "../../include/utils/UterineSamplingProfiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <sys/time.h>
+
+#include "Exception.hpp"
+
+std::vector<void*> UterineSamplingProfiler::msBuffer;
+std::atomic<unsigned long> UterineSamplingProfiler::msNumUsed(0);
+std::atomic<unsigned long> UterineSamplingProfiler::msNumSamples(0);
+std::atomic<unsigned long> UterineSamplingProfiler::msNumDropped(0);
+struct sigaction UterineSamplingProfiler::msPreviousAction;
+bool UterineSamplingProfiler::msRunning = false;
+
+
+void UterineSamplingProfiler::HandleSignal(int signal, siginfo_t* pInfo,
+                                           void* pContext) {
+  // Only async-signal-safe work: the frames are copied to the buffer,
+  // symbols are resolved when writing
+  const int saved_errno = errno;
+  void* frames[MAX_DEPTH];
+  const int depth = backtrace(frames, MAX_DEPTH);
+  // Skip this handler and the signal trampoline
+  const unsigned skipped = 2;
+
+  if (depth > static_cast<int>(skipped)) {
+    const unsigned long size = depth - skipped + 1;
+    const unsigned long start = msNumUsed.fetch_add(size);
+
+    if (start + size < msBuffer.size()) {
+      std::copy(frames + skipped, frames + depth,
+                msBuffer.begin() + start + 1);
+      msBuffer[start] = reinterpret_cast<void*>(size - 1);
+      msNumSamples.fetch_add(1);
+    } else {
+      msNumDropped.fetch_add(1);
+    }
+  }
+  errno = saved_errno;
+}
+
+
+void UterineSamplingProfiler::Start(double interval,
+                                    unsigned long bufferBytes) {
+  if (msRunning) {
+    const std::string err_msg = "Sampling profiler already running";
+    const std::string err_filename = "UterineSamplingProfiler.cpp";
+    unsigned line_number = 57;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  // Zeroed, the first slot of an unwritten sample ends the buffer
+  msBuffer.assign(std::max(bufferBytes / sizeof(void*), 2ul), NULL);
+  msNumUsed = 0;
+  msNumSamples = 0;
+  msNumDropped = 0;
+
+  // The first call of backtrace loads the unwinder, which is not safe in
+  // the signal handler
+  void* frames[MAX_DEPTH];
+  backtrace(frames, MAX_DEPTH);
+
+  struct sigaction action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_sigaction = HandleSignal;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGPROF, &action, &msPreviousAction);
+
+  // CPU time of the process, so that waiting in MPI is sampled as well
+  const long interval_us = std::max(1L, static_cast<long>(interval * 1000));
+  struct itimerval timer;
+  timer.it_interval.tv_sec = interval_us / 1000000;
+  timer.it_interval.tv_usec = interval_us % 1000000;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, NULL);
+  msRunning = true;
+}
+
+
+void UterineSamplingProfiler::Stop() {
+  if (!msRunning) {
+    return;
+  }
+
+  struct itimerval timer;
+  std::memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, NULL);
+
+  // A signal still pending would terminate the process with the default
+  // action
+  if (!(msPreviousAction.sa_flags & SA_SIGINFO) &&
+      msPreviousAction.sa_handler == SIG_DFL) {
+    msPreviousAction.sa_handler = SIG_IGN;
+  }
+  sigaction(SIGPROF, &msPreviousAction, NULL);
+  msRunning = false;
+}
+
+
+unsigned long UterineSamplingProfiler::GetNumSamples() {
+  return msNumSamples;
+}
+
+
+unsigned long UterineSamplingProfiler::GetNumDropped() {
+  return msNumDropped;
+}
+
+
+std::string UterineSamplingProfiler::GetFrameName(void* pAddress,
+                                                  bool isLeaf) {
+  // Return addresses point after the call, which can be the next function
+  const char* p_lookup = static_cast<const char*>(pAddress) -
+    (isLeaf ? 0 : 1);
+  Dl_info info;
+
+  if (dladdr(p_lookup, &info) == 0) {
+    std::ostringstream name;
+    name << pAddress;
+    return name.str();
+  }
+
+  std::string name;
+
+  if (info.dli_sname != NULL) {
+    int status = 0;
+    char* p_demangled = abi::__cxa_demangle(info.dli_sname, NULL, NULL,
+                                            &status);
+    name = status == 0 ? p_demangled : info.dli_sname;
+    free(p_demangled);
+  } else {
+    // Not exported, e.g. functions of an executable linked without
+    // -rdynamic: the module and the offset in it
+    const char* p_module = info.dli_fname == NULL ? "" : info.dli_fname;
+    const char* p_base = std::strrchr(p_module, '/');
+    std::ostringstream offset;
+    offset << (p_base == NULL ? p_module : p_base + 1) << "+0x" << std::hex
+      << (p_lookup - static_cast<const char*>(info.dli_fbase));
+    name = offset.str();
+  }
+
+  // Frames are separated by semicolons in the collapsed format
+  std::replace(name.begin(), name.end(), ';', ':');
+  return name;
+}
+
+
+void UterineSamplingProfiler::Write(const std::string& file_path) {
+  Stop();
+
+  // Identical stacks are counted once, from the outermost frame
+  std::map<void*, std::string> names;
+  std::map<std::string, unsigned long> stacks;
+  const unsigned long num_used = std::min<unsigned long>(msNumUsed,
+                                                         msBuffer.size());
+  unsigned long position = 0;
+
+  while (position < num_used && msBuffer[position] != NULL) {
+    const unsigned long depth =
+      reinterpret_cast<unsigned long>(msBuffer[position]);
+    std::string stack;
+
+    for (unsigned long i = depth; i > 0; --i) {
+      void* p_address = msBuffer[position + i];
+      auto it = names.find(p_address);
+
+      if (it == names.end()) {
+        it = names.emplace(p_address, GetFrameName(p_address, i == 1)).first;
+      }
+      stack += (stack.empty() ? "" : ";") + it->second;
+    }
+    ++stacks[stack];
+    position += depth + 1;
+  }
+
+  std::ofstream profile_file(file_path);
+
+  for (const auto& [stack, count] : stacks) {
+    profile_file << stack << " " << count << "\n";
+  }
+  profile_file.close();
+}
@@ -0,0 +1,156 @@
+#include "../../include/utils/config_fcts.hpp"
+
+namespace {
+toml::value config_overrides = toml::table{};
+std::string general_config_file = "";
+}
+
+
+void set_config_overrides(const toml::value& overrides) {
+  if (!overrides.is_table()) {
+    const std::string err_msg = "Config overrides must be a table";
+    const std::string err_filename = "config_fcts.cpp";
+    unsigned line_number = 13;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+  config_overrides = overrides;
+}
+
+
+void clear_config_overrides() {
+  config_overrides = toml::table{};
+}
+
+
+const toml::value& get_config_overrides() {
+  return config_overrides;
+}
+
+
+ScopedConfigOverrides::ScopedConfigOverrides(const toml::value& overrides) :
+  mPreviousOverrides(config_overrides) {
+  set_config_overrides(overrides);
+}
+
+
+ScopedConfigOverrides::~ScopedConfigOverrides() {
+  config_overrides = mPreviousOverrides;
+}
+
+
+void set_general_config_file(const std::string& config_path) {
+  general_config_file = config_path;
+}
+
+
+const std::string& get_general_config_file() {
+  return general_config_file;
+}
+
+
+toml::value read_config(const std::string& config_path,
+                        const std::string& section) {
+  const bool replace_general = section == "general" &&
+    !general_config_file.empty();
+  toml::value config;
+  UterineEventHandler::BeginEvent(UterineEventHandler::READ_CONFIG);
+
+  try {
+    config = toml::parse(replace_general ? general_config_file : config_path);
+  } catch (...) {
+    UterineEventHandler::EndEvent(UterineEventHandler::READ_CONFIG);
+    throw;
+  }
+  UterineEventHandler::EndEvent(UterineEventHandler::READ_CONFIG);
+
+  if (config_overrides.contains(section)) {
+    merge_toml(config, config_overrides.at(section));
+  }
+  return config;
+}
+
+
+void merge_toml(toml::value& base, const toml::value& overrides) {
+  for (const auto& [key, value] : overrides.as_table()) {
+    if (value.is_table() && base.contains(key) && base.at(key).is_table()) {
+      merge_toml(base.at(key), value);  // Only replace the given keys
+    } else {
+      base.as_table()[key] = value;
+    }
+  }
+}
+
+
+std::string find_config_file(const std::string& config_file) {
+  // Absolute or relative to the current directory first
+  if (std::ifstream(config_file).good()) {
+    return config_file;
+  }
+
+  const char* config_dir = getenv("CHASTE_MODELLING_CONFIG_DIR");
+  const std::string config_path = (config_dir == NULL ? "" : config_dir) +
+    config_file;
+
+  if (!std::ifstream(config_path).good()) {
+    const std::string err_msg = "Unable to find the config file " +
+      config_file;
+    const std::string err_filename = "config_fcts.cpp";
+    unsigned line_number = 80;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+  return config_path;
+}
+
+
+void set_toml_path(toml::value& table, const std::string& dotted_key,
+                   const toml::value& value) {
+  const std::size_t dot = dotted_key.find('.');
+
+  if (!table.is_table()) {
+    table = toml::table{};
+  }
+
+  if (dot == std::string::npos) {
+    table.as_table()[dotted_key] = value;
+    return;
+  }
+
+  // Create the intermediate tables if needed
+  toml::value& sub_table = table.as_table()[dotted_key.substr(0, dot)];
+  set_toml_path(sub_table, dotted_key.substr(dot + 1), value);
+}
+
+
+void add_config_override(toml::value& overrides,
+                         const std::string& assignment) {
+  // Written as [section.]key=value, keys without a section are general
+  const std::size_t equal = assignment.find('=');
+
+  if (equal == std::string::npos || equal == 0) {
+    const std::string err_msg = "Invalid config override " + assignment +
+      ", expected key=value";
+    const std::string err_filename = "config_fcts.cpp";
+    unsigned line_number = 115;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  std::string key = assignment.substr(0, equal);
+  const std::string section = key.substr(0, key.find('.'));
+
+  if (section != "general" && section != "cell" && section != "mesh") {
+    key = "general." + key;
+  }
+
+  // The value is read as TOML, e.g. 1.0, true or [1, 2], or else is taken
+  // as a string
+  toml::value value;
+
+  try {
+    std::istringstream value_stream("value = " + assignment.substr(equal + 1));
+    value = toml::find(toml::parse(value_stream, key), "value");
+  } catch (const std::exception&) {
+    value = toml::value(assignment.substr(equal + 1));
+  }
+
+  set_toml_path(overrides, key, value);
+}
@@ -0,0 +1,101 @@
+#include "../../include/utils/hash_fcts.hpp"
+
+namespace {
+constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+}
+
+
+std::uint64_t hash_string(const std::string& value, std::uint64_t seed) {
+  std::uint64_t hash = seed;
+
+  for (const unsigned char c : value) {
+    hash ^= c;
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+
+std::uint64_t hash_file(const std::string& file_path, std::uint64_t seed) {
+  std::ifstream file(file_path, std::ios::binary);
+
+  if (!file.is_open()) {
+    const std::string err_msg = "Unable to open " + file_path + " for hashing";
+    const std::string err_filename = "hash_fcts.cpp";
+    unsigned line_number = 26;
+    throw Exception(err_msg, err_filename, line_number);
+  }
+
+  std::uint64_t hash = seed;
+  char buffer[65536];
+
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+    const std::streamsize nb_read = file.gcount();
+
+    for (std::streamsize i = 0; i < nb_read; ++i) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= FNV_PRIME;
+    }
+  }
+  return hash;
+}
+
+
+std::uint64_t hash_file_stats(const std::string& file_path,
+                              std::uint64_t seed) {
+  struct stat file_stats;
+  std::uint64_t hash = hash_string(file_path, seed);
+
+  if (stat(file_path.c_str(), &file_stats) != 0) {
+    return hash_string("<missing>", hash);  // Optional file
+  }
+
+  hash = hash_combine(hash, static_cast<std::uint64_t>(file_stats.st_size));
+  hash = hash_combine(hash, static_cast<std::uint64_t>(file_stats.st_mtime));
+  return hash;
+}
+
+
+std::uint64_t hash_toml(const toml::value& value, std::uint64_t seed) {
+  if (value.is_uninitialized()) {
+    return hash_string("<empty>", seed);  // Missing optional value
+  } else if (!value.is_table()) {
+    std::ostringstream value_stream;
+    value_stream << std::setprecision(17) << value;
+    return hash_string(value_stream.str(), seed);
+  }
+
+  // Sort the keys so the hash does not depend on the table ordering
+  std::vector<std::string> keys;
+
+  for (const auto& [key, sub_value] : value.as_table()) {
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::uint64_t hash = seed;
+
+  for (const auto& key : keys) {
+    hash = hash_string(key + "=", hash);
+    hash = hash_toml(value.at(key), hash);
+    hash = hash_string(";", hash);
+  }
+  return hash;
+}
+
+
+std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) {
+  // Hash the bytes of the value into the seed
+  for (unsigned i = 0; i < 8; ++i) {
+    seed ^= (value >> (8*i)) & 0xff;
+    seed *= FNV_PRIME;
+  }
+  return seed;
+}
+
+
+std::string hash_to_string(std::uint64_t hash) {
+  std::ostringstream hash_stream;
+  hash_stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return hash_stream.str();
+}
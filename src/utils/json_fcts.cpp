@@ -0,0 +1,84 @@
+#include "../../include/utils/json_fcts.hpp"
+
+std::string json_string(const std::string& value) {
+  std::ostringstream json_stream;
+  json_stream << '"';
+
+  for (const unsigned char c : value) {
+    if (c == '"' || c == '\\') {
+      json_stream << '\\' << c;
+    } else if (c == '\n') {
+      json_stream << "\\n";
+    } else if (c == '\t') {
+      json_stream << "\\t";
+    } else if (c < 0x20) {  // Other control characters
+      json_stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+        << static_cast<unsigned>(c) << std::dec;
+    } else {
+      json_stream << c;
+    }
+  }
+  json_stream << '"';
+  return json_stream.str();
+}
+
+
+std::string json_number(double value) {
+  if (!std::isfinite(value)) {
+    return "null";  // JSON has no inf or nan
+  }
+
+  // Use the shortest precision that reads back to the same value
+  std::ostringstream json_stream;
+  json_stream << std::setprecision(15) << value;
+
+  if (std::stod(json_stream.str()) != value) {
+    json_stream.str("");
+    json_stream << std::setprecision(17) << value;
+  }
+  return json_stream.str();
+}
+
+
+std::string toml_to_json(const toml::value& value) {
+  if (value.is_uninitialized()) {
+    return "null";
+  } else if (value.is_boolean()) {
+    return value.as_boolean() ? "true" : "false";
+  } else if (value.is_integer()) {
+    return std::to_string(value.as_integer());
+  } else if (value.is_floating()) {
+    return json_number(value.as_floating());
+  } else if (value.is_string()) {
+    return json_string(value.as_string().str);
+  } else if (value.is_array()) {
+    std::string json = "[";
+    const auto& array = value.as_array();
+
+    for (unsigned i = 0; i < array.size(); ++i) {
+      json += (i == 0 ? "" : ", ") + toml_to_json(array[i]);
+    }
+    return json + "]";
+  } else if (value.is_table()) {
+    // Sort the keys so that manifests of identical configs are identical
+    std::vector<std::string> keys;
+
+    for (const auto& [key, sub_value] : value.as_table()) {
+      keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::string json = "{";
+
+    for (unsigned i = 0; i < keys.size(); ++i) {
+      json += (i == 0 ? "" : ", ") + json_string(keys[i]) + ": " +
+        toml_to_json(value.at(keys[i]));
+    }
+    return json + "}";
+  }
+
+  // Dates and times are written as strings
+  std::ostringstream value_stream;
+  value_stream << value;
+  return json_string(value_stream.str());
+}
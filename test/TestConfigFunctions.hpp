@@ -0,0 +1,48 @@
+#ifndef TEST_TESTCONFIGFUNCTIONS_HPP_
+#define TEST_TESTCONFIGFUNCTIONS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "FakePetscSetup.hpp"
+#include "../include/utils/config_fcts.hpp"
+
+
+class TestConfigFunctions : public CxxTest::TestSuite {
+ public:
+  void TestConfigOverrides() {
+    toml::value overrides = toml::table{};
+
+    // Keys without a section are general ones, values are read as TOML
+    add_config_override(overrides, "sim_duration=1000.0");
+    add_config_override(overrides, "cell_type=RoeslerP");
+    add_config_override(overrides, "cell.parameters.gkv=0.5");
+    add_config_override(overrides, "conductivities_3d=[0.1, 0.2, 0.3]");
+
+    TS_ASSERT_DELTA(toml::find<double>(overrides, "general", "sim_duration"),
+                    1000.0, 1e-12);
+    TS_ASSERT_EQUALS(toml::find<std::string>(overrides, "general",
+                                             "cell_type"), "RoeslerP");
+    TS_ASSERT_DELTA(toml::find<double>(overrides, "cell", "parameters", "gkv"),
+                    0.5, 1e-12);
+    TS_ASSERT_EQUALS(toml::find<std::vector<double>>(
+      overrides, "general", "conductivities_3d").size(), 3u);
+    TS_ASSERT_THROWS_THIS(add_config_override(overrides, "sim_duration"),
+      "Invalid config override sim_duration, expected key=value");
+
+    // Only the given keys of a sub-table are replaced
+    std::istringstream config_stream("sim_duration = 5000.0\n"
+                                     "[passive]\ncentre = 1.0\nslope = 2.0\n");
+    toml::value config = toml::parse(config_stream, "config");
+    toml::value passive_overrides = toml::table{};
+    add_config_override(passive_overrides, "passive.slope=3.0");
+    merge_toml(config, toml::find(passive_overrides, "general"));
+
+    TS_ASSERT_DELTA(toml::find<double>(config, "passive", "centre"), 1.0,
+                    1e-12);
+    TS_ASSERT_DELTA(toml::find<double>(config, "passive", "slope"), 3.0,
+                    1e-12);
+    TS_ASSERT_DELTA(toml::find<double>(config, "sim_duration"), 5000.0,
+                    1e-12);
+  }
+};
+
+#endif  // TEST_TESTCONFIGFUNCTIONS_HPP_
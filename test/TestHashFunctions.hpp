@@ -0,0 +1,50 @@
+#ifndef TEST_TESTHASHFUNCTIONS_HPP_
+#define TEST_TESTHASHFUNCTIONS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "FakePetscSetup.hpp"
+#include "OutputFileHandler.hpp"
+#include "../include/utils/hash_fcts.hpp"
+
+
+class TestHashFunctions : public CxxTest::TestSuite {
+ public:
+  void TestHashFunctionsClass() {
+    // Reference values of the 64 bit FNV-1a hash
+    TS_ASSERT_EQUALS(hash_to_string(hash_string("")), "cbf29ce484222325");
+    TS_ASSERT_EQUALS(hash_to_string(hash_string("a")), "af63dc4c8601ec8c");
+    TS_ASSERT_DIFFERS(hash_string("gkv43"), hash_string("gkv44"));
+    TS_ASSERT_DIFFERS(hash_combine(hash_string("a"), 1),
+                      hash_combine(hash_string("a"), 2));
+
+    // Tables with the same values in a different order
+    std::istringstream first_stream("[parameters]\ngna = 0.0625\nE2 = 50.0\n");
+    std::istringstream second_stream("[parameters]\nE2 = 50.0\ngna = 0.0625\n");
+    std::istringstream third_stream("[parameters]\nE2 = 40.0\ngna = 0.0625\n");
+    const auto first = toml::parse(first_stream, "first");
+    const auto second = toml::parse(second_stream, "second");
+    const auto third = toml::parse(third_stream, "third");
+
+    TS_ASSERT_EQUALS(hash_toml(first), hash_toml(second));
+    TS_ASSERT_DIFFERS(hash_toml(first), hash_toml(third));
+    TS_ASSERT_DIFFERS(hash_toml(toml::value()), hash_toml(toml::value("")));
+
+    // Files with the same content have the same hash
+    OutputFileHandler handler("TestHashFunctions", false);
+    out_stream p_file = handler.OpenOutputFile("first.txt");
+    *p_file << "uterus_scaffold";
+    p_file->close();
+    p_file = handler.OpenOutputFile("second.txt");
+    *p_file << "uterus_scaffold";
+    p_file->close();
+
+    const std::string output_dir = handler.GetOutputDirectoryFullPath();
+    TS_ASSERT_EQUALS(hash_file(output_dir + "first.txt"),
+                     hash_string("uterus_scaffold"));
+    TS_ASSERT_EQUALS(hash_file(output_dir + "first.txt"),
+                     hash_file(output_dir + "second.txt"));
+    TS_ASSERT_THROWS_ANYTHING(hash_file(output_dir + "missing.txt"));
+  }
+};
+
+#endif  // TEST_TESTHASHFUNCTIONS_HPP_
@@ -0,0 +1,34 @@
+#ifndef TEST_TESTJSONFUNCTIONS_HPP_
+#define TEST_TESTJSONFUNCTIONS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <limits>
+#include "FakePetscSetup.hpp"
+#include "../include/utils/json_fcts.hpp"
+
+
+class TestJsonFunctions : public CxxTest::TestSuite {
+ public:
+  void TestJsonFunctionsClass() {
+    TS_ASSERT_EQUALS(json_string("uterus"), "\"uterus\"");
+    TS_ASSERT_EQUALS(json_string("a\"b\\c\n"), "\"a\\\"b\\\\c\\n\"");
+    TS_ASSERT_EQUALS(json_number(0.5), "0.5");
+    TS_ASSERT_EQUALS(json_number(std::numeric_limits<double>::infinity()),
+                     "null");
+
+    // Keys are sorted and nested tables are converted to objects
+    std::istringstream config_stream("sim_duration = 10000.0\n"
+                                     "cell_type = \"Roesler\"\n"
+                                     "orthotropic = false\n"
+                                     "[passive]\nconductivities = [1, 2]\n");
+    const auto config = toml::parse(config_stream, "config");
+
+    TS_ASSERT_EQUALS(toml_to_json(config),
+                     "{\"cell_type\": \"Roesler\", \"orthotropic\": false, "
+                     "\"passive\": {\"conductivities\": [1, 2]}, "
+                     "\"sim_duration\": 10000}");
+    TS_ASSERT_EQUALS(toml_to_json(toml::value()), "null");
+  }
+};
+
+#endif  // TEST_TESTJSONFUNCTIONS_HPP_
@@ -0,0 +1,58 @@
+#ifndef TEST_TESTUTERINEACTIVATIONSTATISTICS_HPP_
+#define TEST_TESTUTERINEACTIVATIONSTATISTICS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "PetscVecTools.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "../include/problem/UterineActivationStatistics.hpp"
+
+
+class TestUterineActivationStatistics : public CxxTest::TestSuite {
+ private:
+  void SetVoltages(Vec solution, double first, double others) {
+    for (unsigned i = 0; i < 4; ++i) {
+      PetscVecTools::SetElement(solution, i, i == 0 ? first : others);
+    }
+    PetscVecTools::Finalise(solution);
+  }
+
+ public:
+  void TestUterineActivationStatisticsClass() {
+    DistributedVectorFactory factory(4);
+    Vec solution = factory.CreateVec();
+    UterineActivationStatistics statistics("activation_stats.csv", -40.0);
+    statistics.InitialiseAtStart(&factory);
+
+    // Node 0 activates at 1, 2 and 3 ms, the others never do
+    for (unsigned realisation = 0; realisation < 3; ++realisation) {
+      statistics.StartRealisation();
+      SetVoltages(solution, -60.0, -60.0);
+      statistics.ProcessSolutionAtTimeStep(0.0, solution, 1);
+      SetVoltages(solution, -20.0, -50.0);
+      statistics.ProcessSolutionAtTimeStep(1.0 + realisation, solution, 1);
+      // Staying depolarised is not a new activation
+      statistics.ProcessSolutionAtTimeStep(5.0, solution, 1);
+
+      TS_ASSERT_DELTA(statistics.EndRealisation(), 0.25, 1e-12);
+    }
+
+    TS_ASSERT_EQUALS(statistics.GetNumRealisations(), 3u);
+
+    if (factory.IsGlobalIndexLocal(0)) {
+      TS_ASSERT_DELTA(statistics.GetActivationTime(0), 3.0, 1e-12);
+      TS_ASSERT_DELTA(statistics.GetActivationProbability(0), 1.0, 1e-12);
+      TS_ASSERT_DELTA(statistics.GetMeanActivationTime(0), 2.0, 1e-12);
+      TS_ASSERT_DELTA(statistics.GetActivationTimeStd(0), 1.0, 1e-12);
+    }
+
+    if (factory.IsGlobalIndexLocal(3)) {
+      TS_ASSERT_DELTA(statistics.GetActivationProbability(3), 0.0, 1e-12);
+      TS_ASSERT_DELTA(statistics.GetMeanActivationTime(3), -1.0, 1e-12);
+    }
+
+    PetscTools::Destroy(solution);
+  }
+};
+
+#endif  // TEST_TESTUTERINEACTIVATIONSTATISTICS_HPP_
@@ -0,0 +1,128 @@
+#ifndef TEST_TESTUTERINECOARSEMESH_HPP_
+#define TEST_TESTUTERINECOARSEMESH_HPP_
+
+#include <algorithm>
+#include <cstdlib>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "FileFinder.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "FibreReader.hpp"
+#include "../include/cache/UterineCoarseMesh.hpp"
+
+
+class TestUterineCoarseMesh : public CxxTest::TestSuite {
+ private:
+  std::string mMeshPath = std::string(getenv("CHASTE_SOURCE_DIR")) +
+    "/mesh/uterus/test/tube_10mm";
+
+  bool IsOrthotropic() {
+    return FileFinder(mMeshPath + ".ortho",
+                      RelativeTo::AbsoluteOrCwd).Exists();
+  }
+
+  void CheckFibres(const std::string& cached_path, unsigned numElements) {
+    FibreReader<3> fibre_reader(
+      FileFinder(cached_path + ".ortho", RelativeTo::AbsoluteOrCwd), ORTHO);
+    std::vector<c_vector<double, 3>> fibres;
+    std::vector<c_vector<double, 3>> sheets;
+    std::vector<c_vector<double, 3>> normals;
+    fibre_reader.GetAllOrtho(fibres, sheets, normals);
+    TS_ASSERT_EQUALS(fibres.size(), numElements);
+  }
+
+ public:
+  void TestFineClustersKeepTheMesh() {
+    // Clusters much smaller than the elements hold a single node each
+    const bool orthotropic = IsOrthotropic();
+    UterineCoarseMesh<3> coarse_mesh(mMeshPath, 1e-6);
+
+    // Generated on the first call and loaded on the second
+    for (unsigned i = 0; i < 2; ++i) {
+      const std::string cached_path = coarse_mesh.GetMeshPath(orthotropic);
+      TS_ASSERT(coarse_mesh.IsAvailable(orthotropic));
+      TS_ASSERT_EQUALS(cached_path, coarse_mesh.GetCachedMeshPath());
+
+      TrianglesMeshReader<3, 3> source_reader(mMeshPath);
+      TrianglesMeshReader<3, 3> cached_reader(cached_path);
+      TS_ASSERT_EQUALS(cached_reader.GetNumNodes(),
+                       source_reader.GetNumNodes());
+      TS_ASSERT_EQUALS(cached_reader.GetNumElements(),
+                       source_reader.GetNumElements());
+
+      for (unsigned j = 0; j < source_reader.GetNumNodes(); ++j) {
+        const std::vector<double> source_node = source_reader.GetNextNode();
+        const std::vector<double> cached_node = cached_reader.GetNextNode();
+
+        for (unsigned d = 0; d < 3; ++d) {
+          TS_ASSERT_DELTA(cached_node[d], source_node[d], 1e-12);
+        }
+      }
+
+      // Same nodes, possibly reordered to a positive orientation
+      for (unsigned j = 0; j < source_reader.GetNumElements(); ++j) {
+        std::vector<unsigned> source_indices =
+          source_reader.GetNextElementData().NodeIndices;
+        std::vector<unsigned> cached_indices =
+          cached_reader.GetNextElementData().NodeIndices;
+        std::sort(source_indices.begin(), source_indices.end());
+        std::sort(cached_indices.begin(), cached_indices.end());
+        TS_ASSERT_EQUALS(cached_indices, source_indices);
+      }
+
+      if (orthotropic) {
+        CheckFibres(cached_path, source_reader.GetNumElements());
+      }
+    }
+  }
+
+  void TestCoarseClustersMergeNodes() {
+    TrianglesMeshReader<3, 3> source_reader(mMeshPath);
+    std::vector<double> lower(3, 1e300);
+    std::vector<double> upper(3, -1e300);
+
+    for (unsigned i = 0; i < source_reader.GetNumNodes(); ++i) {
+      const std::vector<double> node = source_reader.GetNextNode();
+
+      for (unsigned d = 0; d < 3; ++d) {
+        lower[d] = std::min(lower[d], node[d]);
+        upper[d] = std::max(upper[d], node[d]);
+      }
+    }
+
+    const double extent = std::max({upper[0] - lower[0],
+                                    upper[1] - lower[1],
+                                    upper[2] - lower[2]});
+    const bool orthotropic = IsOrthotropic();
+    UterineCoarseMesh<3> coarse_mesh(mMeshPath, extent / 20.0);
+    const std::string cached_path = coarse_mesh.GetMeshPath(orthotropic);
+
+    TrianglesMeshReader<3, 3> cached_reader(cached_path);
+    TS_ASSERT_LESS_THAN(cached_reader.GetNumNodes(),
+                        source_reader.GetNumNodes());
+    TS_ASSERT_LESS_THAN(0u, cached_reader.GetNumElements());
+    TS_ASSERT_LESS_THAN(0u, cached_reader.GetNumFaces());
+
+    // The centroids stay within the source mesh
+    for (unsigned i = 0; i < cached_reader.GetNumNodes(); ++i) {
+      const std::vector<double> node = cached_reader.GetNextNode();
+
+      for (unsigned d = 0; d < 3; ++d) {
+        TS_ASSERT_LESS_THAN_EQUALS(lower[d] - 1e-12, node[d]);
+        TS_ASSERT_LESS_THAN_EQUALS(node[d], upper[d] + 1e-12);
+      }
+    }
+
+    if (orthotropic) {
+      CheckFibres(cached_path, cached_reader.GetNumElements());
+    }
+  }
+
+  void TestTooCoarseThrows() {
+    UterineCoarseMesh<3> coarse_mesh(mMeshPath, 1e6);
+    TS_ASSERT_THROWS_CONTAINS(coarse_mesh.GetMeshPath(false),
+                              "Cluster size too large");
+  }
+};
+
+#endif  // TEST_TESTUTERINECOARSEMESH_HPP_
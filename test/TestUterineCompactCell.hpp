@@ -0,0 +1,178 @@
+#ifndef TEST_TESTUTERINECOMPACTCELL_HPP_
+#define TEST_TESTUTERINECOMPACTCELL_HPP_
+
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+#include "AbstractCvodeCell.hpp"
+#include "SimpleStimulus.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "../include/cells/UterineCompactCell.hpp"
+
+class TestUterineCompactCell : public CxxTest::TestSuite {
+ public:
+  void TestUterineCompactCellClass() {
+    #ifdef CHASTE_CVODE
+      typedef UterineCompactCell<CellMeans2023PFromCellMLCvode> CompactCell;
+      boost::shared_ptr<SimpleStimulus> p_stimulus(
+            new SimpleStimulus(-0.5, 2000.0, 100.0));
+      boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+      CellMeans2023PFromCellMLCvode reference(p_solver, p_stimulus);
+      CompactCell* p_first = new CompactCell(p_solver, p_stimulus);
+      CompactCell second(p_solver, p_stimulus);
+
+      boost::shared_ptr<std::vector<double>> p_parameters(
+        new std::vector<double>(reference.GetNumberOfParameters()));
+
+      for (unsigned i = 0; i < p_parameters->size(); ++i) {
+        (*p_parameters)[i] = reference.GetParameter(i);
+      }
+
+      p_first->ShareParameters(p_parameters);
+      second.ShareParameters(p_parameters);
+      TS_ASSERT(p_first->HasSharedParameters());
+
+      // Setting a parameter for one cell copies the shared values first
+      const double g_p = reference.GetParameter("g_p");
+      second.SetPrivateParameter("g_p", 2*g_p);
+      TS_ASSERT(!second.HasSharedParameters());
+      TS_ASSERT_DELTA(second.GetParameter("g_p"), 2*g_p, 1e-12);
+      TS_ASSERT_DELTA(p_first->GetParameter("g_p"), g_p, 1e-12);
+
+      // The shared values outlive the cells that point to them
+      delete p_first;
+      TS_ASSERT_EQUALS(p_parameters.use_count(), 1);
+
+      // Sharing does not change the solution
+      CompactCell shared(p_solver, p_stimulus);
+      shared.ShareParameters(p_parameters);
+
+      for (unsigned i = 0; i < 10; ++i) {
+        reference.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+        shared.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+      }
+
+      TS_ASSERT_DELTA(shared.GetVoltage(), reference.GetVoltage(), 1e-12);
+
+      // Values of the wrong size are not shared
+      boost::shared_ptr<std::vector<double>> p_wrong_size(
+        new std::vector<double>(1));
+      TS_ASSERT_THROWS_THIS(shared.ShareParameters(p_wrong_size),
+                            "Shared parameters of the wrong size");
+
+      // Pooled states keep their values and are solved in place
+      boost::shared_ptr<UterineCellStatePool> p_pool(
+        new UterineCellStatePool(
+          reference.GetNumberOfStateVariables()*sizeof(double)));
+      CompactCell pooled(p_solver, p_stimulus);
+      CellMeans2023PFromCellMLCvode unpooled(p_solver, p_stimulus);
+      pooled.UseStatePool(p_pool);
+      TS_ASSERT(pooled.HasPooledState());
+      TS_ASSERT_DELTA(pooled.GetVoltage(), unpooled.GetVoltage(), 1e-12);
+
+      for (unsigned i = 0; i < 10; ++i) {
+        unpooled.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+        pooled.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+      }
+
+      TS_ASSERT_DELTA(pooled.GetVoltage(), unpooled.GetVoltage(), 1e-12);
+
+      // A reset or set state replaces the vector, its values are moved back
+      // to the pool
+      double* p_pooled_values = NV_DATA_S(pooled.rGetStateVariables());
+      const std::vector<double> solved_states =
+        unpooled.GetStdVecStateVariables();
+      pooled.ResetToInitialConditions();
+      unpooled.ResetToInitialConditions();
+      AbstractUterineCompactCell::ExpandCellState(&pooled);
+      TS_ASSERT_EQUALS(NV_DATA_S(pooled.rGetStateVariables()),
+                       p_pooled_values);
+      TS_ASSERT_DELTA(pooled.GetVoltage(), unpooled.GetVoltage(), 1e-12);
+
+      pooled.SetStateVariables(solved_states);
+      unpooled.SetStateVariables(solved_states);
+      pooled.SolveAndUpdateState(1000.0, 1100.0);
+      unpooled.SolveAndUpdateState(1000.0, 1100.0);
+      TS_ASSERT_EQUALS(NV_DATA_S(pooled.rGetStateVariables()),
+                       p_pooled_values);
+      TS_ASSERT_DELTA(pooled.GetVoltage(), unpooled.GetVoltage(), 1e-12);
+
+      // Cells beyond the size of the pool get another block
+      CompactCell second_pooled(p_solver, p_stimulus);
+      second_pooled.UseStatePool(p_pool);
+      TS_ASSERT_EQUALS(p_pool->GetNumBytes(),
+                       2*sizeof(double)*reference.GetNumberOfStateVariables());
+
+      // Single precision states are solved in double, one cell at a time
+      boost::shared_ptr<UterineCellStatePool> p_float_pool(
+        new UterineCellStatePool(
+          reference.GetNumberOfStateVariables()*sizeof(float)));
+      CompactCell first_float(p_solver, p_stimulus);
+      CompactCell second_float(p_solver, p_stimulus);
+      CellMeans2023PFromCellMLCvode unrounded(p_solver, p_stimulus);
+      first_float.UseFloatState(p_float_pool);
+      second_float.UseFloatState(p_float_pool);
+      TS_ASSERT(first_float.HasFloatState());
+      TS_ASSERT_DELTA(first_float.GetVoltage(), unrounded.GetVoltage(), 1e-4);
+
+      for (unsigned i = 0; i < 10; ++i) {
+        unrounded.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+        first_float.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+        second_float.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+      }
+
+      TS_ASSERT_DELTA(first_float.GetVoltage(), second_float.GetVoltage(),
+                      1e-12);
+      TS_ASSERT_DELTA(first_float.GetVoltage(), unrounded.GetVoltage(), 1e-2);
+      // Other uses of the state expand the cell first
+      AbstractUterineCompactCell::ExpandCellState(&first_float);
+      const std::vector<double> first_states =
+        first_float.GetStdVecStateVariables();
+      AbstractUterineCompactCell::ExpandCellState(&second_float);
+      TS_ASSERT_DELTA(first_states[0],
+                      second_float.GetStdVecStateVariables()[0], 1e-12);
+      TS_ASSERT_EQUALS(p_float_pool->GetNumBytes(),
+                       2*sizeof(float)*reference.GetNumberOfStateVariables());
+
+      // A reset state replaces the vector, its values are kept in single
+      // precision, whether the cell is expanded or not
+      const std::vector<double> solved_states =
+        unrounded.GetStdVecStateVariables();
+      const unsigned voltage_index = first_float.GetVoltageIndex();
+      unrounded.ResetToInitialConditions();
+      first_float.ResetToInitialConditions();
+      AbstractUterineCompactCell::ExpandCellState(&second_float);
+      TS_ASSERT_DELTA(first_float.GetVoltage(), unrounded.GetVoltage(), 1e-4);
+      second_float.ResetToInitialConditions();
+      AbstractUterineCompactCell::ExpandCellState(&first_float);
+      TS_ASSERT_DELTA(second_float.GetVoltage(), unrounded.GetVoltage(),
+                      1e-4);
+
+      // A loaded state, as by the warm start cache
+      first_float.SetStateVariables(solved_states);
+      TS_ASSERT_DELTA(first_float.GetVoltage(), solved_states[voltage_index],
+                      1e-12);
+      AbstractUterineCompactCell::ExpandCellState(&second_float);
+      TS_ASSERT_DELTA(first_float.GetVoltage(), solved_states[voltage_index],
+                      1e-4);
+      AbstractUterineCompactCell::ExpandCellState(&first_float);
+      const std::vector<double> loaded_states =
+        first_float.GetStdVecStateVariables();
+      TS_ASSERT_EQUALS(loaded_states.size(), solved_states.size());
+
+      for (unsigned i = 0; i < solved_states.size(); ++i) {
+        TS_ASSERT_DELTA(loaded_states[i], solved_states[i],
+                        1e-6*std::fabs(solved_states[i]));
+      }
+
+      // And solved from there as a cell in double
+      unrounded.SetStateVariables(solved_states);
+      unrounded.SolveAndUpdateState(1000.0, 1100.0);
+      first_float.SolveAndUpdateState(1000.0, 1100.0);
+      TS_ASSERT_DELTA(first_float.GetVoltage(), unrounded.GetVoltage(), 1e-2);
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+};
+
+#endif  // TEST_TESTUTERINECOMPACTCELL_HPP_
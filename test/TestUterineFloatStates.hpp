@@ -0,0 +1,117 @@
+#ifndef TEST_TESTUTERINEFLOATSTATES_HPP_
+#define TEST_TESTUTERINEFLOATSTATES_HPP_
+
+#include <cmath>
+#include <algorithm>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "../include/factories/UterineSimpleCellFactory.hpp"
+#include "../include/problem/UterineMonodomainProblem.hpp"
+#include "../include/problem/UterineActivationStatistics.hpp"
+#include "../include/utils/config_fcts.hpp"
+
+
+class TestUterineFloatStates : public CxxTest::TestSuite {
+ private:
+  // Activation times of the owned nodes of the tube, -1 if not activated
+  std::vector<double> SolveTube(bool float_states) {
+    UterineSimpleCellFactory<3> factory;
+    factory.SetCellType("Means");
+    factory.ReadCellParams(factory.GetCellParamFile());
+    factory.SetFloatStates(float_states);
+
+    // Half a second after the stimulus
+    const auto cell_params = read_config(USMC_SYSTEM_CONSTANTS::CONFIG_DIR +
+                                         factory.GetCellParamFile(), "cell");
+    const double sim_duration =
+      toml::find<double>(cell_params, "start_time") + 500.0;  // ms
+
+    UterineMonodomainProblem<3> problem(&factory);
+    HeartConfig::Instance()->SetOutputDirectory(
+      float_states ? "TestUterineFloatStates/float" :
+      "TestUterineFloatStates/double");
+    HeartConfig::Instance()->SetSimulationDuration(sim_duration);
+    HeartConfig::Instance()->SetMeshFileName("mesh/uterus/test/tube_10mm");
+    HeartConfig::Instance()->SetOutputFilenamePrefix("results");
+    HeartConfig::Instance()->SetIntracellularConductivities(
+        Create_c_vector(1.75, 0.19));
+    HeartConfig::Instance()->SetSurfaceAreaToVolumeRatio(1400);  // 1/cm
+    HeartConfig::Instance()->SetCapacitance(1.0);  // uF/cm^3
+    HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.1, 0.1, 0.1);
+
+    boost::shared_ptr<UterineActivationStatistics> p_statistics(
+      new UterineActivationStatistics("activation_stats.csv", -40.0));
+    problem.AddOutputModifier(p_statistics);
+    problem.Initialise();
+    problem.Solve();
+    p_statistics->EndRealisation();
+
+    DistributedVectorFactory* p_vector_factory =
+      problem.rGetMesh().GetDistributedVectorFactory();
+    std::vector<double> activation_times;
+
+    for (unsigned index = p_vector_factory->GetLow();
+         index < p_vector_factory->GetHigh();
+         ++index) {
+      activation_times.push_back(p_statistics->GetActivationTime(index));
+    }
+    return activation_times;
+  }
+
+ public:
+  void TestFloatStatesActivationTimes() {
+    #ifdef CHASTE_CVODE
+      // Accuracy report of single precision state storage, against double
+      // storage on the same partition
+      const std::vector<double> double_times = SolveTube(false);
+      const std::vector<double> float_times = SolveTube(true);
+      TS_ASSERT_EQUALS(double_times.size(), float_times.size());
+
+      double local_values[3] = {0.0, 0.0, 0.0};  // Max, sum and count
+      unsigned local_mismatches = 0;  // Activated with one storage only
+
+      for (unsigned i = 0; i < double_times.size(); ++i) {
+        if ((double_times[i] < 0.0) != (float_times[i] < 0.0)) {
+          ++local_mismatches;
+        } else if (double_times[i] >= 0.0) {
+          const double difference = std::fabs(float_times[i] -
+                                              double_times[i]);
+          local_values[0] = std::max(local_values[0], difference);
+          local_values[1] += difference;
+          local_values[2] += 1.0;
+        }
+      }
+
+      double max_difference;
+      double sums[2];
+      unsigned mismatches;
+      MPI_Allreduce(local_values, &max_difference, 1, MPI_DOUBLE, MPI_MAX,
+                    PETSC_COMM_WORLD);
+      MPI_Allreduce(local_values + 1, sums, 2, MPI_DOUBLE, MPI_SUM,
+                    PETSC_COMM_WORLD);
+      MPI_Allreduce(&local_mismatches, &mismatches, 1, MPI_UNSIGNED, MPI_SUM,
+                    PETSC_COMM_WORLD);
+
+      if (PetscTools::AmMaster()) {
+        std::cout << "Activated nodes: " << sums[1] << "\n";
+        std::cout << "Nodes activated with one storage only: " << mismatches
+          << "\n";
+        std::cout << "Max activation time difference: " << max_difference
+          << " ms\n";
+        std::cout << "Mean activation time difference: "
+          << (sums[1] > 0.0 ? sums[0] / sums[1] : 0.0) << " ms"
+          << std::endl;
+      }
+
+      // The tube activates, within a millisecond of double storage
+      TS_ASSERT_LESS_THAN(0.0, sums[1]);
+      TS_ASSERT_EQUALS(mismatches, 0u);
+      TS_ASSERT_LESS_THAN_EQUALS(max_difference, 1.0);
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+};
+
+#endif  // TEST_TESTUTERINEFLOATSTATES_HPP_
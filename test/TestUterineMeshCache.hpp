@@ -0,0 +1,114 @@
+#ifndef TEST_TESTUTERINEMESHCACHE_HPP_
+#define TEST_TESTUTERINEMESHCACHE_HPP_
+
+#include <cstdlib>
+#include <filesystem>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "FibreReader.hpp"
+#include "../include/cache/UterineMeshCache.hpp"
+
+
+class TestUterineMeshCache : public CxxTest::TestSuite {
+ private:
+  void CompareFibres(const std::string& source_path,
+                     const std::string& cached_path) {
+    std::vector<c_vector<double, 3>> fibres[2];
+    std::vector<c_vector<double, 3>> sheets[2];
+    std::vector<c_vector<double, 3>> normals[2];
+    const std::string paths[2] = {source_path, cached_path};
+
+    for (unsigned i = 0; i < 2; ++i) {
+      FibreReader<3> fibre_reader(
+        FileFinder(paths[i] + ".ortho", RelativeTo::AbsoluteOrCwd), ORTHO);
+      fibre_reader.GetAllOrtho(fibres[i], sheets[i], normals[i]);
+    }
+
+    TS_ASSERT_EQUALS(fibres[1].size(), fibres[0].size());
+
+    for (unsigned i = 0; i < fibres[0].size() && i < fibres[1].size(); ++i) {
+      for (unsigned d = 0; d < 3; ++d) {
+        TS_ASSERT_EQUALS(fibres[1][i][d], fibres[0][i][d]);
+        TS_ASSERT_EQUALS(sheets[1][i][d], sheets[0][i][d]);
+        TS_ASSERT_EQUALS(normals[1][i][d], normals[0][i][d]);
+      }
+    }
+  }
+
+ public:
+  void TestGenerateAndReload() {
+    const std::string mesh_path = std::string(getenv("CHASTE_SOURCE_DIR")) +
+      "/mesh/uterus/test/tube_10mm";
+    const bool orthotropic = FileFinder(mesh_path + ".ortho",
+                                        RelativeTo::AbsoluteOrCwd).Exists();
+    UterineMeshCache<3> cache(mesh_path);
+
+    // Generated on the first call and loaded on the second
+    for (unsigned i = 0; i < 2; ++i) {
+      const std::string cached_path = cache.GetMeshPath(orthotropic);
+      TS_ASSERT(cache.IsAvailable(orthotropic));
+      TS_ASSERT_EQUALS(cached_path, cache.GetCachedMeshPath());
+
+      TrianglesMeshReader<3, 3> source_reader(mesh_path);
+      TrianglesMeshReader<3, 3> cached_reader(cached_path);
+      TS_ASSERT(cached_reader.IsFileFormatBinary());
+      TS_ASSERT_EQUALS(cached_reader.GetNumNodes(),
+                       source_reader.GetNumNodes());
+      TS_ASSERT_EQUALS(cached_reader.GetNumElements(),
+                       source_reader.GetNumElements());
+      TS_ASSERT_EQUALS(cached_reader.GetNumFaces(),
+                       source_reader.GetNumFaces());
+
+      for (unsigned j = 0; j < source_reader.GetNumNodes(); ++j) {
+        const std::vector<double> source_node = source_reader.GetNextNode();
+        const std::vector<double> cached_node = cached_reader.GetNextNode();
+        TS_ASSERT_EQUALS(cached_node.size(), source_node.size());
+
+        for (unsigned d = 0; d < 3; ++d) {
+          TS_ASSERT_EQUALS(cached_node[d], source_node[d]);
+        }
+      }
+
+      for (unsigned j = 0; j < source_reader.GetNumElements(); ++j) {
+        TS_ASSERT_EQUALS(cached_reader.GetNextElementData().NodeIndices,
+                         source_reader.GetNextElementData().NodeIndices);
+      }
+
+      if (orthotropic) {
+        CompareFibres(mesh_path, cached_path);
+      }
+    }
+  }
+
+  void TestFibresAddedToCache() {
+    const std::string mesh_path = std::string(getenv("CHASTE_SOURCE_DIR")) +
+      "/mesh/uterus/test/tube_10mm";
+
+    if (!FileFinder(mesh_path + ".ortho", RelativeTo::AbsoluteOrCwd).Exists()) {
+      return;  // The source mesh has no fibres
+    }
+
+    UterineMeshCache<3> cache(mesh_path);
+
+    if (PetscTools::AmMaster()) {
+      std::filesystem::remove_all(
+        OutputFileHandler::GetChasteTestOutputDirectory() +
+        cache.GetCacheDir());
+    }
+    PetscTools::Barrier("TestFibresAddedToCache");
+
+    // A cache without the fibres is replaced by one with them
+    cache.GetMeshPath(false);
+    TS_ASSERT(cache.IsAvailable(false));
+    TS_ASSERT(!cache.IsAvailable(true));
+
+    const std::string cached_path = cache.GetMeshPath(true);
+    TS_ASSERT(cache.IsAvailable(true));
+    CompareFibres(mesh_path, cached_path);
+  }
+};
+
+#endif  // TEST_TESTUTERINEMESHCACHE_HPP_
@@ -0,0 +1,113 @@
+#ifndef TEST_TESTUTERINEMESHPARTITIONCACHE_HPP_
+#define TEST_TESTUTERINEMESHPARTITIONCACHE_HPP_
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "PetscVecTools.hpp"
+#include "OutputFileHandler.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "../include/cache/UterineMeshPartitionCache.hpp"
+#include "../include/problem/UterineActivationStatistics.hpp"
+
+
+class TestUterineMeshPartitionCache : public CxxTest::TestSuite {
+ private:
+  std::string mMeshPath = std::string(getenv("CHASTE_SOURCE_DIR")) +
+    "/mesh/uterus/test/tube_10mm";
+
+  // Writes the activation times of a wave that depends on the position of
+  // the nodes only, through the node permutation of the mesh
+  std::string WriteActivationTimes(DistributedTetrahedralMesh<3, 3>& rMesh,
+                                   const std::string& file_name) {
+    DistributedVectorFactory* p_vector_factory =
+      rMesh.GetDistributedVectorFactory();
+    Vec solution = p_vector_factory->CreateVec();
+    UterineActivationStatistics statistics(file_name, -40.0);
+    statistics.InitialiseAtStart(p_vector_factory);
+
+    for (unsigned time = 0; time <= 20; ++time) {
+      for (auto iter = rMesh.GetNodeIteratorBegin();
+           iter != rMesh.GetNodeIteratorEnd(); ++iter) {
+        const c_vector<double, 3>& r_location = iter->rGetLocation();
+        const double onset = 10.0 * (1.0 + std::sin(
+          1e3 * (r_location[0] + r_location[1] + r_location[2])));
+        PetscVecTools::SetElement(solution, iter->GetIndex(),
+                                  time < onset ? -60.0 : 0.0);
+      }
+      PetscVecTools::Finalise(solution);
+      statistics.ProcessSolutionAtTimeStep(time, solution, 1);
+    }
+    statistics.EndRealisation();
+
+    OutputFileHandler handler("TestUterineMeshPartitionCache", false);
+    const std::string file_path = handler.GetOutputDirectoryFullPath() +
+      file_name;
+    statistics.WriteStatistics(file_path, rMesh.rGetNodePermutation());
+    PetscTools::Destroy(solution);
+    return file_path;
+  }
+
+  std::string ReadFile(const std::string& file_path) {
+    std::ifstream file(file_path);
+    std::stringstream file_stream;
+    file_stream << file.rdbuf();
+    return file_stream.str();
+  }
+
+  void CheckCachedMesh(const std::string& weights_key) {
+    // Partitioned by Chaste
+    TrianglesMeshReader<3, 3> mesh_reader(mMeshPath);
+    DistributedTetrahedralMesh<3, 3> mesh(
+      DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY);
+    mesh.ConstructFromMeshReader(mesh_reader);
+    const std::string source_path = WriteActivationTimes(mesh,
+                                                         "source.csv");
+
+    // Read back from the cache, generated by the first call
+    UterineMeshPartitionCache<3> cache(mMeshPath, weights_key);
+
+    if (!weights_key.empty()) {
+      cache.SetNodeWeights(std::vector<double>(mesh.GetNumNodes(), 1.0));
+    }
+
+    for (unsigned i = 0; i < 2; ++i) {
+      cache.GetMeshPath(false);
+      TS_ASSERT(cache.IsAvailable(false));
+
+      DistributedTetrahedralMesh<3, 3> cached_mesh(
+        DistributedTetrahedralMeshPartitionType::DUMB);
+      cache.ConstructMesh(cached_mesh);
+      TS_ASSERT_EQUALS(cached_mesh.GetNumNodes(), mesh.GetNumNodes());
+      TS_ASSERT_EQUALS(cached_mesh.GetNumElements(), mesh.GetNumElements());
+      TS_ASSERT_EQUALS(cached_mesh.rGetNodePermutation().size(),
+                       cache.ReadPermutation().size());
+
+      // Same node order as the source mesh
+      const std::string cached_path = WriteActivationTimes(cached_mesh,
+                                                           "cached.csv");
+
+      if (PetscTools::AmMaster()) {
+        const std::string source_times = ReadFile(source_path);
+        TS_ASSERT_LESS_THAN(100u, source_times.size());
+        TS_ASSERT_EQUALS(ReadFile(cached_path), source_times);
+      }
+    }
+  }
+
+ public:
+  void TestPartitionCacheNodeOrder() {
+    HeartConfig::Instance()->SetMeshPartitioning("parmetis");
+    CheckCachedMesh("");
+  }
+
+  void TestWeightedPartitionCacheNodeOrder() {
+    CheckCachedMesh("TestUterineMeshPartitionCache");
+  }
+};
+
+#endif  // TEST_TESTUTERINEMESHPARTITIONCACHE_HPP_
@@ -0,0 +1,136 @@
+#ifndef TEST_TESTUTERINEPARTITIONWEIGHTS_HPP_
+#define TEST_TESTUTERINEPARTITIONWEIGHTS_HPP_
+
+#include <cmath>
+#include <cstdlib>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "FakeBathCell.hpp"
+#include "OutputFileHandler.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "../include/cache/UterineMeshPartitionCache.hpp"
+#include "../include/cache/UterinePartitionWeights.hpp"
+#include "../include/problem/UterineCellCosts.hpp"
+
+// Cell with a given ODE time, as a profiled cell at the end of a run
+class CostedCell : public FakeBathCell, public AbstractUterineCellProfile {
+ public:
+  explicit CostedCell(double odeTime) :
+    FakeBathCell(boost::shared_ptr<AbstractIvpOdeSolver>(),
+                 boost::shared_ptr<AbstractStimulusFunction>()) {
+    mOdeTime = odeTime;
+  }
+};
+
+
+class TestUterinePartitionWeights : public CxxTest::TestSuite {
+ private:
+  std::string mMeshPath = std::string(getenv("CHASTE_SOURCE_DIR")) +
+    "/mesh/uterus/test/tube_10mm";
+
+  double Cost(const c_vector<double, 3>& rLocation) {
+    return 1.0 + std::fabs(rLocation[0]) + std::fabs(rLocation[1]) +
+      std::fabs(rLocation[2]);
+  }
+
+  // Writes the costs of the owned cells and reads them back as weights
+  std::vector<double> RoundTrip(const std::vector<double>& rCellTimes,
+                                unsigned low,
+                                const std::vector<unsigned>& rPermutation,
+                                const std::string& file_name) {
+    std::vector<AbstractCardiacCellInterface*> cells;
+
+    for (const double cell_time : rCellTimes) {
+      cells.push_back(new CostedCell(cell_time));
+    }
+
+    OutputFileHandler handler("TestUterinePartitionWeights", false);
+    const std::string cost_map_path = handler.GetOutputDirectoryFullPath() +
+      file_name;
+    UterineCellCosts costs(cells, low, 1.0);
+    costs.WriteCostMap(cost_map_path, rPermutation);
+    PetscTools::Barrier("RoundTrip");
+
+    for (auto p_cell : cells) {
+      delete p_cell;
+    }
+
+    UterinePartitionWeights<3> weights(mMeshPath);
+    weights.ReadCostMap(cost_map_path);
+    TS_ASSERT_DIFFERS(weights.GetKey(), "");
+    return weights.rGetWeights();
+  }
+
+ public:
+  void TestCostMapOfPermutedNodes() {
+    // The cells of a reversed mesh, all on the master process
+    TrianglesMeshReader<3, 3> mesh_reader(mMeshPath);
+    const unsigned num_nodes = mesh_reader.GetNumNodes();
+    std::vector<unsigned> permutation(num_nodes);
+    std::vector<double> cell_times;
+
+    for (unsigned i = 0; i < num_nodes; ++i) {
+      permutation[i] = num_nodes - 1 - i;
+    }
+
+    if (PetscTools::AmMaster()) {
+      for (unsigned i = 0; i < num_nodes; ++i) {
+        cell_times.push_back(1.0 + num_nodes - 1 - i);
+      }
+    }
+
+    const std::vector<double> weights = RoundTrip(cell_times, 0, permutation,
+                                                  "reversed_costs.csv");
+
+    if (PetscTools::AmMaster()) {
+      TS_ASSERT_EQUALS(weights.size(), num_nodes);
+
+      for (unsigned i = 0; i < weights.size(); ++i) {
+        TS_ASSERT_DELTA(weights[i], 1.0 + i, 1e-12);
+      }
+    }
+  }
+
+  void TestCostMapOfPartitionCachedMesh() {
+    // Costs of a partition cached run, which depend on the position of the
+    // nodes only
+    UterineMeshPartitionCache<3> cache(mMeshPath, "");
+    cache.GetMeshPath(false);
+    DistributedTetrahedralMesh<3, 3> mesh(
+      DistributedTetrahedralMeshPartitionType::DUMB);
+    cache.ConstructMesh(mesh);
+
+    const unsigned low = mesh.GetDistributedVectorFactory()->GetLow();
+    std::vector<double> cell_times(
+      mesh.GetDistributedVectorFactory()->GetLocalOwnership(), 0.0);
+
+    for (auto iter = mesh.GetNodeIteratorBegin();
+         iter != mesh.GetNodeIteratorEnd(); ++iter) {
+      cell_times.at(iter->GetIndex() - low) = Cost(iter->rGetLocation());
+    }
+
+    const std::vector<double> weights = RoundTrip(
+      cell_times, low, mesh.rGetNodePermutation(), "cached_costs.csv");
+
+    // Read back in the order of the source mesh
+    if (PetscTools::AmMaster()) {
+      TrianglesMeshReader<3, 3> mesh_reader(mMeshPath);
+      TS_ASSERT_EQUALS(weights.size(), mesh_reader.GetNumNodes());
+
+      for (unsigned i = 0; i < weights.size(); ++i) {
+        const std::vector<double> node = mesh_reader.GetNextNode();
+        c_vector<double, 3> location;
+
+        for (unsigned d = 0; d < 3; ++d) {
+          location[d] = node[d];
+        }
+
+        const double cost = Cost(location);
+        TS_ASSERT_DELTA(weights[i], cost, 1e-5 * cost);
+      }
+    }
+  }
+};
+
+#endif  // TEST_TESTUTERINEPARTITIONWEIGHTS_HPP_
@@ -0,0 +1,75 @@
+#ifndef TEST_TESTUTERINEPASSIVETISSUECELL_HPP_
+#define TEST_TESTUTERINEPASSIVETISSUECELL_HPP_
+
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+#include "AbstractCvodeCell.hpp"
+#include "ZeroStimulus.hpp"
+#include "HeartConfig.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "../include/cells/UterinePassiveTissueCell.hpp"
+#include "../include/factories/UterineZeroCellFactory.hpp"
+
+class TestUterinePassiveTissueCell : public CxxTest::TestSuite {
+ public:
+  void TestUterinePassiveTissueCellClass() {
+    #ifdef CHASTE_CVODE
+      boost::shared_ptr<ZeroStimulus> p_stimulus(new ZeroStimulus());
+      boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+      UterinePassiveTissueCell cell(p_solver, p_stimulus);
+      TS_ASSERT_EQUALS(cell.GetNumberOfStateVariables(), 1u);
+
+      const double g_leak = cell.GetParameter("g_leak");
+      const double e_leak = cell.GetParameter("E_leak");
+      const double cm = cell.GetParameter("Cm");
+      cell.SetVoltage(e_leak + 30.0);
+      TS_ASSERT_DELTA(cell.GetIIonic(),
+                      g_leak * 30.0 *
+                      HeartConfig::Instance()->GetCapacitance() / cm,
+                      1e-12);
+
+      // Output variables of the passive models
+      TS_ASSERT_DELTA(cell.GetAnyVariable("v_p", 0.0), e_leak + 30.0, 1e-12);
+      TS_ASSERT_DELTA(cell.GetAnyVariable("g_p", 0.0), 0.0, 1e-12);
+
+      // The tissue solves the voltage, nothing else changes
+      cell.ComputeExceptVoltage(0.0, 100.0);
+      TS_ASSERT_DELTA(cell.GetVoltage(), e_leak + 30.0, 1e-12);
+
+      // Exponential relaxation to the reversal potential
+      cell.SolveAndUpdateState(0.0, 500.0);
+      TS_ASSERT_DELTA(cell.GetVoltage(),
+                      e_leak + 30.0 * std::exp(-g_leak * 500.0 / cm), 1e-3);
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+
+  void TestPassiveTissueLabel() {
+    #ifdef CHASTE_CVODE
+      // Nodes with the label get the passive tissue cell
+      UterineZeroCellFactory<3> factory;
+      factory.SetPassiveTissueLabel(2);
+      Node<3> labelled(0, ChastePoint<3>(0.0, 0.0, 0.0));
+      labelled.AddNodeAttribute(2.0);
+      Node<3> other(1, ChastePoint<3>(0.0, 0.0, 0.0));
+      other.AddNodeAttribute(1.0);
+
+      AbstractCvodeCell* p_passive =
+        factory.CreateCardiacCellForTissueNode(&labelled);
+      AbstractCvodeCell* p_excitable =
+        factory.CreateCardiacCellForTissueNode(&other);
+      TS_ASSERT(dynamic_cast<UterinePassiveTissueCell*>(p_passive) != NULL);
+      TS_ASSERT(dynamic_cast<UterinePassiveTissueCell*>(p_excitable) == NULL);
+      TS_ASSERT_DELTA(p_passive->GetVoltage(),
+                      p_passive->GetParameter("E_leak"), 1e-12);
+
+      delete p_passive;
+      delete p_excitable;
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+};
+
+#endif  // TEST_TESTUTERINEPASSIVETISSUECELL_HPP_
@@ -0,0 +1,212 @@
+#ifndef TEST_TESTUTERINEPERFORMANCE_HPP_
+#define TEST_TESTUTERINEPERFORMANCE_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include "PetscSetupAndFinalize.hpp"
+#include "FileFinder.hpp"
+#include "TetrahedralMesh.hpp"
+#include "ZeroStimulus.hpp"
+#include "../include/factories/AbstractUterineCellFactoryTemplate.hpp"
+#include "../include/factories/UterineZeroCellFactory.hpp"
+#include "../include/conductivity/UterineConductivityModifier.hpp"
+#include "../include/toml.hpp"
+
+// Costs are given in units of a fixed reference workload timed on the same
+// machine, so that the baselines hold on other hardware. A test fails when
+// its cost is above the tolerance times its baseline. A cost without a
+// baseline is recorded as its baseline with a warning, and setting
+// UTERINE_RECORD_BASELINES records all the costs of this machine.
+class TestUterinePerformance : public CxxTest::TestSuite {
+ private:
+  const std::vector<std::string> mCellTypes = {
+    "HodgkinHuxley", "ChayKeizer", "Means", "MeansP", "Tong", "Roesler",
+    "RoeslerP"};
+  const std::string mBaselineFile =
+    "projects/uterine-modelling/test/data/performance_baselines.toml";
+  std::map<std::string, std::map<std::string, double>> mBaselines;
+  double mTolerance = 2.0;
+  double mReferenceTime = 0.0;
+  bool mRecord = false;
+
+  // Fastest of a few runs, the others include warm up and noise
+  double BestTime(std::function<void()> workload, unsigned num_runs = 5) {
+    double best_time = std::numeric_limits<double>::infinity();
+
+    for (unsigned i = 0; i < num_runs; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      workload();
+      const std::chrono::duration<double> time =
+        std::chrono::steady_clock::now() - start;
+      best_time = std::min(best_time, time.count());
+    }
+    return best_time;
+  }
+
+  void SetUpBaselines() {
+    if (mReferenceTime > 0.0) {
+      return;
+    }
+
+    // Floating point and memory bound work similar to the ODE updates
+    std::vector<double> values(1 << 16, 1.0);
+    double checksum = 0.0;
+    mReferenceTime = BestTime([&values, &checksum]() {
+      for (unsigned repeat = 0; repeat < 20; ++repeat) {
+        for (auto& value : values) {
+          value = 0.999 * value + 1e-3 * std::exp(-value);
+        }
+      }
+      checksum += values[0];
+    });
+    TS_ASSERT(std::isfinite(checksum));
+    std::cout << "Reference time: " << mReferenceTime << " s" << std::endl;
+
+    mRecord = getenv("UTERINE_RECORD_BASELINES") != NULL;
+    FileFinder baseline_file(mBaselineFile, RelativeTo::ChasteSourceRoot);
+
+    if (!baseline_file.Exists()) {
+      return;
+    }
+
+    const auto baselines = toml::parse(baseline_file.GetAbsolutePath());
+    mTolerance = toml::find_or<double>(baselines, "tolerance", 2.0);
+
+    for (const auto& [section, values] : baselines.as_table()) {
+      if (!values.is_table()) {
+        continue;
+      }
+
+      for (const auto& [name, value] : values.as_table()) {
+        mBaselines[section][name] = toml::get<double>(value);
+      }
+    }
+  }
+
+  void CheckCost(const std::string& section, const std::string& name,
+                 double time) {
+    const double cost = time / mReferenceTime;
+    std::cout << section << "." << name << ": " << cost << std::endl;
+
+    if (mRecord || mBaselines[section].count(name) == 0) {
+      if (!mRecord) {
+        const std::string message = "No performance baseline for " +
+          section + "." + name + ", recorded from this run";
+        TS_WARN(message.c_str());
+      }
+      mBaselines[section][name] = cost;
+      WriteBaselines();
+    } else {
+      TS_ASSERT_LESS_THAN_EQUALS(cost,
+                                 mTolerance * mBaselines[section][name]);
+    }
+  }
+
+  void WriteBaselines() {
+    FileFinder baseline_file(mBaselineFile, RelativeTo::ChasteSourceRoot);
+    std::ofstream output_file(baseline_file.GetAbsolutePath());
+
+    output_file << "# Costs of the performance tests of "
+      "TestUterinePerformance.hpp, in units" << std::endl;
+    output_file << "# of its reference workload, recorded with "
+      "UTERINE_RECORD_BASELINES set" << std::endl;
+    output_file << "tolerance = " << mTolerance
+      << "  # Largest cost increase before a test fails" << std::endl;
+
+    for (const auto& [section, values] : mBaselines) {
+      output_file << std::endl << "[" << section << "]" << std::endl;
+
+      for (const auto& [name, cost] : values) {
+        output_file << name << " = " << std::setprecision(4) << cost
+          << std::endl;
+      }
+    }
+    output_file.close();
+  }
+
+ public:
+  void TestCellCreation() {
+    #ifdef CHASTE_CVODE
+      SetUpBaselines();
+      TetrahedralMesh<3, 3> mesh;
+      mesh.ConstructRegularSlabMesh(0.1, 0.5, 0.5, 2.0);
+
+      for (const auto& cell_type : mCellTypes) {
+        UterineZeroCellFactory<3> factory;
+        factory.SetCellType(cell_type);
+        factory.SetEstrus("");
+        factory.ReadCellParams(factory.GetCellParamFile());
+
+        // Cost per node, including the parameters and passive properties
+        const double time = BestTime([&factory, &mesh]() {
+          for (unsigned i = 0; i < mesh.GetNumNodes(); ++i) {
+            delete factory.CreateCardiacCellForTissueNode(mesh.GetNode(i));
+          }
+        });
+        CheckCost("cell_creation", cell_type, time / mesh.GetNumNodes());
+      }
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+
+  void TestConductivityModifier() {
+    SetUpBaselines();
+    TetrahedralMesh<3, 3> mesh;
+    mesh.ConstructRegularSlabMesh(0.1, 0.5, 0.5, 2.0);
+    c_matrix<double, 3, 3> conductivity = identity_matrix<double>(3);
+
+    for (const std::string distribution : {"linear", "gaussian"}) {
+      UterineConductivityModifier modifier(1.0, 5.0, 0.5, 1.0, distribution,
+                                           &mesh);
+      double checksum = 0.0;
+
+      // Cost per element
+      const double time = BestTime([&]() {
+        for (unsigned i = 1; i < mesh.GetNumElements(); ++i) {
+          checksum += modifier.rCalculateModifiedConductivityTensor(
+            i, conductivity, 0)(2, 2);
+        }
+      });
+      TS_ASSERT(std::isfinite(checksum));
+      CheckCost("conductivity_modifier", distribution,
+                time / (mesh.GetNumElements() - 1));
+    }
+  }
+
+  void TestSingleCellOde() {
+    #ifdef CHASTE_CVODE
+      SetUpBaselines();
+      boost::shared_ptr<AbstractStimulusFunction> p_stimulus(
+        new ZeroStimulus());
+
+      for (const auto& cell_type : mCellTypes) {
+        UterineZeroCellFactory<3> factory;
+        factory.SetCellType(cell_type);
+        factory.SetEstrus("");
+        factory.ReadCellParams(factory.GetCellParamFile());
+
+        // Cost per simulated ms of a cell at rest, as in the tissue
+        const double duration = 1000.0;
+        const double time = BestTime([&factory, &p_stimulus, duration]() {
+          AbstractCvodeCell* p_cell = NULL;
+          factory.InitCell(p_cell, p_stimulus);
+          factory.SetCellParams(p_cell);
+          p_cell->SolveAndUpdateState(0.0, duration);
+          delete p_cell;
+        }, 3);
+        CheckCost("ode", cell_type, time / duration);
+      }
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+};
+
+#endif  // TEST_TESTUTERINEPERFORMANCE_HPP_
@@ -0,0 +1,47 @@
+#ifndef TEST_TESTUTERINEPROFILEDCELL_HPP_
+#define TEST_TESTUTERINEPROFILEDCELL_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "AbstractCvodeCell.hpp"
+#include "SimpleStimulus.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "../include/cells/UterineProfiledCell.hpp"
+#include "../include/problem/UterineCellCosts.hpp"
+
+class TestUterineProfiledCell : public CxxTest::TestSuite {
+ public:
+  void TestUterineProfiledCellClass() {
+    #ifdef CHASTE_CVODE
+      boost::shared_ptr<SimpleStimulus> p_stimulus(
+            new SimpleStimulus(-0.5, 2000.0, 100.0));
+      boost::shared_ptr<AbstractIvpOdeSolver> p_solver;
+      CellMeans2023FromCellMLCvode reference(p_solver, p_stimulus);
+      UterineProfiledCell<CellMeans2023FromCellMLCvode> profiled(p_solver,
+                                                                 p_stimulus);
+
+      TS_ASSERT_EQUALS(profiled.GetNumRhsEvaluations(), 0u);
+
+      // Profiling does not change the solution
+      for (unsigned i = 0; i < 10; ++i) {
+        reference.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+        profiled.SolveAndUpdateState(100.0*i, 100.0*(i + 1));
+      }
+
+      TS_ASSERT_DELTA(profiled.GetVoltage(), reference.GetVoltage(), 1e-12);
+      TS_ASSERT_LESS_THAN(0u, profiled.GetNumCvodeSteps());
+      TS_ASSERT_LESS_THAN_EQUALS(profiled.GetNumCvodeSteps(),
+                                 profiled.GetNumRhsEvaluations());
+      TS_ASSERT_LESS_THAN(0.0, profiled.GetOdeTime());
+
+      // Only the profiled cell is counted
+      std::vector<AbstractCardiacCellInterface*> cells = {&reference,
+                                                          &profiled};
+      UterineCellCosts costs(cells, 0, 1.0);
+      TS_ASSERT_EQUALS(costs.GetNumProfiled(), 1u);
+    #else
+      std::cout << "Cvode is not enabled.\n";
+    #endif
+  }
+};
+
+#endif  // TEST_TESTUTERINEPROFILEDCELL_HPP_
@@ -0,0 +1,81 @@
+#ifndef TEST_TESTUTERINEPROGRESSREPORT_HPP_
+#define TEST_TESTUTERINEPROGRESSREPORT_HPP_
+
+#include <fstream>
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "PetscVecTools.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "OutputFileHandler.hpp"
+#include "../include/problem/UterineProgressReport.hpp"
+
+
+class TestUterineProgressReport : public CxxTest::TestSuite {
+ private:
+  void SetVoltages(Vec solution, unsigned numActive) {
+    for (unsigned i = 0; i < 4; ++i) {
+      PetscVecTools::SetElement(solution, i, i < numActive ? -20.0 : -60.0);
+    }
+    PetscVecTools::Finalise(solution);
+  }
+
+ public:
+  void TestUterineProgressReportClass() {
+    OutputFileHandler handler("TestUterineProgressReport");
+    const std::string status_path = handler.GetOutputDirectoryFullPath() +
+      "status.json";
+
+    DistributedVectorFactory factory(4);
+    Vec solution = factory.CreateVec();
+    // Status at every printing step, a line only at the end of the runs
+    UterineProgressReport progress(status_path, 10.0, 0.1, 4, -40.0, 1e6, 1);
+    progress.InitialiseAtStart(&factory);
+
+    SetVoltages(solution, 1);
+    progress.ProcessSolutionAtTimeStep(0.0, solution, 1);
+    TS_ASSERT_EQUALS(progress.GetNumRuns(), 1u);
+    TS_ASSERT_DELTA(progress.GetActiveFraction(), 0.25, 1e-12);
+    TS_ASSERT_DELTA(progress.GetRemainingTime(), -1.0, 1e-12);
+
+    SetVoltages(solution, 3);
+    progress.ProcessSolutionAtTimeStep(5.0, solution, 1);
+    TS_ASSERT_DELTA(progress.GetActiveFraction(), 0.75, 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(0.0, progress.GetRemainingTime());
+    TS_ASSERT_LESS_THAN_EQUALS(0.0, progress.GetNodeStepsPerSecond());
+
+    // The start of the next chunk of a solve repeats the last time
+    SetVoltages(solution, 0);
+    progress.ProcessSolutionAtTimeStep(5.0, solution, 1);
+    TS_ASSERT_EQUALS(progress.GetNumRuns(), 1u);
+    TS_ASSERT_DELTA(progress.GetActiveFraction(), 0.75, 1e-12);
+
+    progress.ProcessSolutionAtTimeStep(10.0, solution, 1);
+    TS_ASSERT_DELTA(progress.GetActiveFraction(), 0.0, 1e-12);
+    TS_ASSERT_DELTA(progress.GetRemainingTime(), 0.0, 1e-12);
+    progress.FinaliseAtEnd();
+
+    if (PetscTools::AmMaster()) {
+      std::ifstream status_file(status_path);
+      TS_ASSERT(status_file.is_open());
+      std::stringstream status_stream;
+      status_stream << status_file.rdbuf();
+      const std::string status = status_stream.str();
+      TS_ASSERT_DIFFERS(status.find("\"run\": 1,"), std::string::npos);
+      TS_ASSERT_DIFFERS(status.find("\"time\": 10,"), std::string::npos);
+      TS_ASSERT_DIFFERS(status.find("\"active_fraction\": 0,"),
+                        std::string::npos);
+    }
+
+    // The time going back is the next realisation
+    SetVoltages(solution, 4);
+    progress.ProcessSolutionAtTimeStep(0.0, solution, 1);
+    TS_ASSERT_EQUALS(progress.GetNumRuns(), 2u);
+    TS_ASSERT_DELTA(progress.GetActiveFraction(), 1.0, 1e-12);
+    TS_ASSERT_DELTA(progress.GetRemainingTime(), -1.0, 1e-12);
+
+    PetscTools::Destroy(solution);
+  }
+};
+
+#endif  // TEST_TESTUTERINEPROGRESSREPORT_HPP_
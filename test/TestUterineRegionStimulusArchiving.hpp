@@ -0,0 +1,68 @@
+#ifndef TEST_TESTUTERINEREGIONSTIMULUSARCHIVING_HPP_
+#define TEST_TESTUTERINEREGIONSTIMULUSARCHIVING_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "CheckpointArchiveTypes.hpp"
+#include "OutputFileHandler.hpp"
+#include "FakePetscSetup.hpp"
+#include "../include/stimulus/UterineRegionStimulus.hpp"
+
+
+class TestUterineRegionStimulusArchiving : public CxxTest::TestSuite {
+ public:
+  void TestUterineRegionStimulusArchivingClass() {
+    OutputFileHandler handler("UterineArchiving", false);
+    std::string archive_filename = handler.GetOutputDirectoryFullPath() +
+      "region_stimulus.arch";
+    std::vector<unsigned> expected_regions;
+
+    {  // Save the stimulus part way through the random sequence
+      boost::shared_ptr<UterineRegionSelector> selector(
+        new UterineRegionSelector());
+      boost::shared_ptr<UterineRegionStimulus> stimulus(
+        new UterineRegionStimulus(-0.5, 10.0, 100.0, 5.0, selector));
+      stimulus->SetRegionProbs({0.3, 0.3, 0.4});
+      stimulus->SetRegion(2);
+
+      for (unsigned i = 0; i < 7; ++i) {
+        selector->SelectRegion();
+      }
+
+      boost::shared_ptr<AbstractStimulusFunction> p_stimulus = stimulus;
+      std::ofstream ofs(archive_filename.c_str());
+      boost::archive::text_oarchive output_arch(ofs);
+      output_arch << p_stimulus;
+
+      // Regions the generator would have selected after the save
+      for (unsigned i = 0; i < 20; ++i) {
+        expected_regions.push_back(selector->SelectRegion());
+      }
+    }
+
+    {  // Load and check the stimulus and generator position are restored
+      boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
+      std::ifstream ifs(archive_filename.c_str(), std::ios::binary);
+      boost::archive::text_iarchive input_arch(ifs);
+      input_arch >> p_stimulus;
+
+      boost::shared_ptr<UterineRegionStimulus> stimulus =
+        boost::dynamic_pointer_cast<UterineRegionStimulus>(p_stimulus);
+      TS_ASSERT(stimulus != nullptr);
+      TS_ASSERT_DELTA(stimulus->GetMagnitude(), -0.5, 1e-9);
+      TS_ASSERT_DELTA(stimulus->GetDuration(), 10.0, 1e-9);
+      TS_ASSERT_DELTA(stimulus->GetPeriod(), 100.0, 1e-9);
+      TS_ASSERT_DELTA(stimulus->GetStartTime(), 5.0, 1e-9);
+      TS_ASSERT_DELTA(stimulus->GetStimulus(1.0), 0.0, 1e-9);
+
+      boost::shared_ptr<UterineRegionSelector> selector =
+        stimulus->GetSelector();
+      TS_ASSERT(selector != nullptr);
+
+      for (unsigned i = 0; i < expected_regions.size(); ++i) {
+        TS_ASSERT_EQUALS(selector->SelectRegion(), expected_regions[i]);
+      }
+    }
+  }
+};
+
+#endif  // TEST_TESTUTERINEREGIONSTIMULUSARCHIVING_HPP_
@@ -0,0 +1,67 @@
+#ifndef TEST_TESTUTERINERESULTCACHE_HPP_
+#define TEST_TESTUTERINERESULTCACHE_HPP_
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+#include "PetscSetupAndFinalize.hpp"
+#include "OutputFileHandler.hpp"
+#include "FileFinder.hpp"
+#include "../include/cache/UterineResultCache.hpp"
+
+
+class TestUterineResultCache : public CxxTest::TestSuite {
+ private:
+  std::string ReadFile(const std::string& file_path) {
+    std::ifstream file(file_path);
+    std::stringstream file_stream;
+    file_stream << file.rdbuf();
+    return file_stream.str();
+  }
+
+ public:
+  void TestStoreAndRestore() {
+    UterineResultCache cache("TestUterineResultCache");
+
+    // Stored by the first run of the test only otherwise
+    if (PetscTools::AmMaster()) {
+      std::filesystem::remove_all(
+        OutputFileHandler::GetChasteTestOutputDirectory() +
+        cache.GetCacheDir());
+    }
+    PetscTools::Barrier("TestStoreAndRestore");
+    TS_ASSERT(!cache.IsAvailable());
+
+    OutputFileHandler output_handler("TestUterineResultCache/output");
+    const std::string output_path =
+      output_handler.GetOutputDirectoryFullPath();
+
+    if (PetscTools::AmMaster()) {
+      std::filesystem::create_directories(output_path + "results");
+      std::ofstream(output_path + "results/voltage.csv") << "0,-60\n1,-20\n";
+      std::ofstream(output_path + "log.txt") << "key: test\n";
+    }
+    PetscTools::Barrier("TestStoreAndRestore");
+
+    cache.Store("TestUterineResultCache/output");
+    TS_ASSERT(cache.IsAvailable());
+
+    OutputFileHandler restore_handler("TestUterineResultCache/restored");
+    const std::string restore_path =
+      restore_handler.GetOutputDirectoryFullPath();
+    cache.Restore("TestUterineResultCache/restored");
+
+    if (PetscTools::AmMaster()) {
+      TS_ASSERT_EQUALS(ReadFile(restore_path + "results/voltage.csv"),
+                       "0,-60\n1,-20\n");
+      TS_ASSERT_EQUALS(ReadFile(restore_path + "log.txt"), "key: test\n");
+
+      // The marker stays in the cache
+      TS_ASSERT(!FileFinder(restore_path + ".complete",
+                            RelativeTo::AbsoluteOrCwd).Exists());
+    }
+  }
+};
+
+#endif  // TEST_TESTUTERINERESULTCACHE_HPP_
@@ -0,0 +1,59 @@
+#ifndef TEST_TESTUTERINESAMPLINGPROFILER_HPP_
+#define TEST_TESTUTERINESAMPLINGPROFILER_HPP_
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+#include "FakePetscSetup.hpp"
+#include "OutputFileHandler.hpp"
+#include "../include/utils/UterineSamplingProfiler.hpp"
+
+
+class TestUterineSamplingProfiler : public CxxTest::TestSuite {
+ private:
+  double Work() {
+    volatile double sum = 0.0;
+
+    for (unsigned i = 0; i < 20000000; ++i) {
+      sum = sum + std::sin(i * 1e-3);
+    }
+    return sum;
+  }
+
+ public:
+  void TestUterineSamplingProfilerClass() {
+    OutputFileHandler handler("TestUterineSamplingProfiler", false);
+    const std::string profile_path =
+      handler.GetOutputDirectoryFullPath() + "profile.folded";
+
+    UterineSamplingProfiler::Start(0.1, 1024 * 1024);
+    TS_ASSERT_THROWS_THIS(UterineSamplingProfiler::Start(0.1, 1024),
+                          "Sampling profiler already running");
+    Work();
+    UterineSamplingProfiler::Write(profile_path);
+    TS_ASSERT_LESS_THAN(0u, UterineSamplingProfiler::GetNumSamples());
+    TS_ASSERT_EQUALS(UterineSamplingProfiler::GetNumDropped(), 0u);
+
+    // Collapsed stacks: frames separated by semicolons, then the count
+    std::ifstream profile_file(profile_path);
+    std::string line;
+    unsigned long num_samples = 0;
+
+    while (std::getline(profile_file, line)) {
+      const size_t separator = line.rfind(' ');
+      TS_ASSERT(separator != std::string::npos);
+      num_samples += std::stoul(line.substr(separator + 1));
+    }
+    TS_ASSERT_EQUALS(num_samples, UterineSamplingProfiler::GetNumSamples());
+
+    // Samples that do not fit in the buffer are dropped
+    UterineSamplingProfiler::Start(0.1, 2 * sizeof(void*));
+    Work();
+    UterineSamplingProfiler::Stop();
+    TS_ASSERT_EQUALS(UterineSamplingProfiler::GetNumSamples(), 0u);
+    TS_ASSERT_LESS_THAN(0u, UterineSamplingProfiler::GetNumDropped());
+  }
+};
+
+#endif  // TEST_TESTUTERINESAMPLINGPROFILER_HPP_